@@ -0,0 +1,117 @@
+#ifndef BENCHMARK_SRC_BENCHMARKS_H_
+#define BENCHMARK_SRC_BENCHMARKS_H_
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+
+namespace benchmark
+{
+
+/**
+ * Heap allocations of the process while count_allocations is set,
+ * including the allocations of ImGui and of the layer, see main.cpp.
+ */
+extern std::atomic<bool> count_allocations;
+extern std::atomic<uint64_t> allocation_count;
+
+void* CountingAlloc(size_t size, void* user_data);
+void  CountingFree(void* pointer, void* user_data);
+
+/**
+ * The modes of the program. Every mode returns the exit code of the
+ * program, the count is the number of frames or repetitions.
+ *
+ * Measures the frame time of a document with 10k text objects.
+ */
+int RunFrameBenchmark(int count);
+
+/**
+ * Fails if updating a document with every interactive object type
+ * allocates memory after the warm-up frames. The mouse hovers and holds
+ * one of the buttons while the allocations are counted.
+ */
+int CheckFrameAllocations(int count);
+
+/**
+ * Measures the token throughput of the lexer, including the look ahead
+ * calls of the parser.
+ */
+int RunTokenBenchmark(int count);
+
+/**
+ * Measures the parse time of a colour-heavy theme document, which
+ * consists mostly of vector values and references to them.
+ */
+int RunThemeBenchmark(int count);
+
+/**
+ * Measures the time ParseFile takes for a file with 50k objects and
+ * reports the peak resident set size of the process.
+ */
+int RunParseBenchmark(int count);
+
+/**
+ * Measures the time the lexer and the parser take for a document with
+ * a million int and float literals.
+ */
+int RunNumberBenchmark(int count);
+
+/**
+ * Compares the time ParseFile takes for a file with 50k objects with the
+ * time LoadCompiledFile takes for the compiled file. The files are written
+ * again and removed from the page cache before every load.
+ */
+int RunColdStartBenchmark(int count);
+
+/**
+ * Fails if a float is converted differently than by std::strtof, either
+ * from a string value or from a float token of the lexer. The count is
+ * the number of random decimals that are checked after the edge cases.
+ */
+int CheckFloatConversion(int count);
+
+/**
+ * Fails if a compiled file does not load the same object tree as its
+ * source, or if a truncated or corrupted compiled file is not handled.
+ * The count is the number of corrupted files.
+ */
+int CheckCompiledFiles(int count);
+
+/**
+ * Fails if the streaming mode of the parser returns a different result or
+ * object tree than the node tree mode, for every test file of the sandbox
+ * and for documents with errors. The count is the number of runs.
+ */
+int CheckStreamingMode(int count);
+
+/**
+ * Builds a colour-heavy theme document, also used as the input of the
+ * token benchmark.
+ */
+std::string BuildThemeDocument();
+
+/**
+ * Builds a document with the given number of objects of every type,
+ * using IDs and references the way a real document would.
+ */
+std::string BuildObjectDocument(size_t object_count);
+
+/**
+ * Directory of the files written by the modes, inside the temp directory.
+ * Every mode removes the directory when it is done.
+ */
+std::filesystem::path GetBenchmarkDirectory();
+
+bool WriteFile(const std::filesystem::path& path, const std::string& data);
+bool ReadFile(const std::filesystem::path& path, std::string& dest);
+
+/**
+ * Peak resident set size of the process in KiB.
+ */
+size_t GetPeakMemoryUsage();
+
+}  // namespace benchmark
+
+#endif  // BENCHMARK_SRC_BENCHMARKS_H_
@@ -0,0 +1,634 @@
+#include "imgui.h"
+#include "imgui_markup.h"
+
+#include "benchmarks.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace gui = imgui_markup;
+
+namespace benchmark
+{
+
+namespace
+{
+
+/**
+ * Numbers around the limits of the fast float path of the layer: trailing
+ * and leading decimal points, negative zero, mantissas around 2^24, long
+ * fractions and numbers that only the slow path supports.
+ */
+const char* const kFloatEdgeCases[] = {
+    "0", "-0", "0.0", "-0.0", "5.", "-5.", ".5", "-.5", "+1.5", " 2.5",
+    "16777215", "16777216", "16777217", "16777218", "-16777217",
+    "1677721.7", "167772.17", "0.16777217",
+    "0.1", "0.2", "0.3", "0.7", "3.14159", "-273.15",
+    "0.0000000001", "0.00000000001", "1.0000000001",
+    "0.33333333333333333333", "1.00000005960464477539",
+    "123456789012345678901234567890", "9999999999", "4294967296",
+    "1e10", "1.5e3", "-2.5E-3", "3.4028235e38", "1e39", "1e-45",
+    "inf", "-inf", "nan"
+};
+
+bool SameFloat(float left, float right)
+{
+    if (std::isnan(left) || std::isnan(right))
+        return std::isnan(left) && std::isnan(right);
+
+    return std::memcmp(&left, &right, sizeof(float)) == 0;
+}
+
+/**
+ * Enough digits to tell every float apart.
+ */
+std::string FloatToString(float value)
+{
+    std::ostringstream stream;
+    stream << std::setprecision(9) << value;
+
+    return stream.str();
+}
+
+/**
+ * Converts the number through a string attribute value, which accepts
+ * every number format.
+ */
+bool ConvertString(const std::string& number, float& dest)
+{
+    gui::AttributeValue value;
+    if (!gui::AttributeValue(number).ConvertTo(gui::AttributeType::kFloat,
+                                               value))
+    {
+        return false;
+    }
+
+    dest = value.Get<float>();
+    return true;
+}
+
+/**
+ * Numbers that the lexer creates a float token of: a digit or '-' followed
+ * by number chars with a decimal point.
+ */
+bool IsFloatToken(const std::string& number)
+{
+    if (number.empty() || (number[0] != '-' && !std::isdigit(
+            static_cast<unsigned char>(number[0]))))
+    {
+        return false;
+    }
+
+    if (number.find('.') == number.npos)
+        return false;
+
+    for (size_t i = 1; i < number.size(); i++)
+    {
+        if (number[i] != '.' &&
+            !std::isdigit(static_cast<unsigned char>(number[i])))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+std::string RandomDecimal(std::mt19937& random)
+{
+    std::uniform_int_distribution<int> integer_digits(0, 9);
+    std::uniform_int_distribution<int> fraction_digits(0, 12);
+    std::uniform_int_distribution<int> digit(0, 9);
+    std::uniform_int_distribution<int> sign(0, 3);
+
+    std::string number = sign(random) == 0 ? "-" : "";
+
+    const int integer_count = integer_digits(random);
+    for (int i = 0; i < integer_count; i++)
+        number += static_cast<char>('0' + digit(random));
+
+    number += '.';
+
+    // A number needs at least one digit
+    const int fraction_count = integer_count ?
+        fraction_digits(random) : std::max(1, fraction_digits(random));
+    for (int i = 0; i < fraction_count; i++)
+        number += static_cast<char>('0' + digit(random));
+
+    return number;
+}
+
+/**
+ * Parses every float token inside a single document, so that the numbers
+ * are converted by the lexer.
+ *
+ * @return number of mismatches.
+ */
+size_t CheckFloatTokens(const std::vector<std::string>& numbers)
+{
+    std::string markup;
+    for (size_t i = 0; i < numbers.size(); i++)
+    {
+        markup += "Float : f" + std::to_string(i) + " { value = " +
+                  numbers[i] + " }\n";
+    }
+
+    gui::GlobalObject global_object;
+    const gui::ParserResult result = gui::ParseData(markup, global_object);
+
+    if (result.type_ != gui::ParserResultType::kSuccess)
+    {
+        std::cerr << "Unable to parse the float tokens:" << std::endl
+                  << result.ToString() << std::endl;
+        return numbers.size();
+    }
+
+    size_t mismatches = 0;
+
+    for (size_t i = 0; i < numbers.size(); i++)
+    {
+        const gui::AttributeHandle handle = global_object.GetAttributeHandle(
+            "f" + std::to_string(i) + ".value");
+        const gui::Float* value = global_object.Get<gui::Float>(handle);
+
+        const float expected = std::strtof(numbers[i].c_str(), nullptr);
+
+        if (!value || !SameFloat(value->value, expected))
+        {
+            std::cerr << "Float token " << numbers[i] << " was converted to "
+                      << (value ? FloatToString(value->value) : "nothing")
+                      << ", expected " << FloatToString(expected)
+                      << std::endl;
+            mismatches++;
+        }
+    }
+
+    return mismatches;
+}
+
+/**
+ * Document with every attribute type, nested IDs, references and escaped
+ * strings, which is compiled by the compiled file check.
+ */
+const char* const kCompiledFileDocument = R"(
+Bool   : enabled { value = true }
+Int    : count   { value = -42 }
+Float  : scale   { value = 0.1 }
+Float2 : offset  { value = (16777217, -0.0) }
+Float3 : axis    { value = (0.5, scale.value, 3) }
+Float4 : tint    { value = (1, 0.5, 0.25, 1) }
+String : label   { value = "A \"quoted\" label with a \\ backslash" }
+
+Panel : panel
+{
+    title    = label.value
+    position = offset.value
+    size     = (320, 200)
+
+    ChildPanel : child
+    {
+        size = (300, 150)
+
+        Container
+        {
+            Text : text { text = "Text" color = tint.value }
+            Button : button
+            {
+                text = panel.child.text.text
+                ButtonStyle : style { color = tint.value }
+            }
+        }
+    }
+}
+)";
+
+bool SameValue(const gui::AttributeValue& left,
+               const gui::AttributeValue& right)
+{
+    if (left.GetType() != right.GetType())
+        return false;
+
+    switch (left.GetType())
+    {
+    case gui::AttributeType::kBool:
+        return left.Get<bool>() == right.Get<bool>();
+    case gui::AttributeType::kFloat:
+        return SameFloat(left.Get<float>(), right.Get<float>());
+    case gui::AttributeType::kFloat2:
+        return left.Get<gui::AttributeValue::Vector2>() ==
+               right.Get<gui::AttributeValue::Vector2>();
+    case gui::AttributeType::kFloat3:
+        return left.Get<gui::AttributeValue::Vector3>() ==
+               right.Get<gui::AttributeValue::Vector3>();
+    case gui::AttributeType::kFloat4:
+        return left.Get<gui::AttributeValue::Vector4>() ==
+               right.Get<gui::AttributeValue::Vector4>();
+    case gui::AttributeType::kInt:
+        return left.Get<int>() == right.Get<int>();
+    case gui::AttributeType::kString:
+        return left.Get<std::string>() == right.Get<std::string>();
+    default:
+        return false;
+    }
+}
+
+/**
+ * Compares the type, ID, attributes and children of two object trees.
+ *
+ * @return number of differences.
+ */
+size_t CompareObjects(gui::Object& expected, gui::Object& loaded)
+{
+    if (expected.GetType() != loaded.GetType() ||
+        expected.GetID() != loaded.GetID())
+    {
+        std::cerr << "Loaded " << loaded.GetType() << " " << loaded.GetID()
+                  << " instead of " << expected.GetType() << " "
+                  << expected.GetID() << std::endl;
+        return 1;
+    }
+
+    size_t differences = 0;
+
+    for (const gui::AttributeDescriptor& descriptor :
+         expected.GetAttributeTable())
+    {
+        if (!SameValue(descriptor.access(expected).GetValue(),
+                       descriptor.access(loaded).GetValue()))
+        {
+            std::cerr << "Attribute " << descriptor.name.String()
+                      << " of " << expected.GetType() << " "
+                      << expected.GetID() << " differs: "
+                      << descriptor.access(loaded).GetValue().ToString()
+                      << " instead of "
+                      << descriptor.access(expected).GetValue().ToString()
+                      << std::endl;
+            differences++;
+        }
+    }
+
+    auto expected_child = expected.GetChildren().begin();
+    auto loaded_child   = loaded.GetChildren().begin();
+
+    for (; expected_child != expected.GetChildren().end() &&
+           loaded_child != loaded.GetChildren().end();
+         ++expected_child, ++loaded_child)
+    {
+        differences += CompareObjects(*expected_child, *loaded_child);
+    }
+
+    if (expected_child != expected.GetChildren().end() ||
+        loaded_child != loaded.GetChildren().end())
+    {
+        std::cerr << "The children of " << expected.GetType() << " "
+                  << expected.GetID() << " differ" << std::endl;
+        differences++;
+    }
+
+    return differences;
+}
+
+/**
+ * Loads a damaged compiled file. The file may only be loaded if the
+ * damage is not detectable, e.g. a changed float value. Otherwise the
+ * load has to fail and leave the global object empty.
+ *
+ * @return false if the load did not behave as expected.
+ */
+bool LoadDamagedFile(const std::filesystem::path& path,
+                     const std::string& data, bool has_to_fail,
+                     const char* description)
+{
+    if (!WriteFile(path, data))
+    {
+        std::cerr << "Unable to write " << path << std::endl;
+        return false;
+    }
+
+    gui::GlobalObject global_object;
+    const gui::ParserResult result =
+        gui::LoadCompiledFile(path.string().c_str(), global_object);
+
+    if (result.type_ == gui::ParserResultType::kSuccess)
+    {
+        if (!has_to_fail)
+            return true;
+
+        std::cerr << "A " << description << " file was loaded" << std::endl;
+        return false;
+    }
+
+    if (!global_object.GetChildren().Empty())
+    {
+        std::cerr << "A " << description << " file left objects behind: "
+                  << result.message_ << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * Documents that fail in different stages of the parser. The streaming
+ * mode interprets the objects in front of the error and continues to
+ * parse after an interpreter error, but has to report the same error as
+ * the node tree mode and leave the global object empty.
+ */
+const char* const kStreamingErrorCases[] = {
+    // Interpreter error, then a lexer error
+    R"(
+Panel : panel
+{
+    unknown_attribute = 5
+    Text { text = "Text" }
+}
+Text { text = "Text" } ?
+)",
+    // Two interpreter errors
+    R"(
+Panel : first  { title = missing.value }
+Panel : second { size = "Text" }
+)",
+    // Syntax error after valid objects
+    R"(
+Float : scale { value = 0.5 }
+Panel : panel
+{
+    size = (scale.value, 100)
+    Text { text = "Text" }
+}
+Panel { size = (100, 100
+)",
+    // Reference to an object in front of an interpreter error
+    R"(
+Int : count { value = 3 }
+Panel : panel { title = count.value size = count }
+)"
+};
+
+/**
+ * Directory of the test files of the sandbox, either relative to the
+ * root of the repository or to the directory of the benchmark project.
+ */
+std::filesystem::path FindTestDirectory()
+{
+    for (const char* directory : { "sandbox/tests", "../sandbox/tests" })
+    {
+        std::error_code error;
+        if (std::filesystem::is_directory(directory, error))
+            return directory;
+    }
+
+    return { };
+}
+
+bool SamePosition(const gui::ParserPosition& left,
+                  const gui::ParserPosition& right)
+{
+    return left.file_stack == right.file_stack && left.line == right.line &&
+           left.line_number == right.line_number &&
+           left.start == right.start && left.end == right.end;
+}
+
+/**
+ * Compares the results and the object trees of both parser modes.
+ *
+ * @return number of differences.
+ */
+template<typename ParseFunction>
+size_t CompareParserModes(const std::string& name, ParseFunction parse)
+{
+    gui::GlobalObject node_tree;
+    gui::GlobalObject streaming;
+
+    const gui::ParserResult expected =
+        parse(node_tree, gui::ParserMode::kNodeTree);
+    const gui::ParserResult result =
+        parse(streaming, gui::ParserMode::kStreaming);
+
+    if (expected.type_ != result.type_ ||
+        expected.message_ != result.message_ ||
+        !SamePosition(expected.position_, result.position_))
+    {
+        std::cerr << name << ": The streaming mode returned" << std::endl
+                  << result.ToString() << std::endl << "instead of"
+                  << std::endl << expected.ToString() << std::endl;
+        return 1;
+    }
+
+    if (!expected && (!node_tree.GetChildren().Empty() ||
+                      !streaming.GetChildren().Empty()))
+    {
+        std::cerr << name << ": Objects were left behind after an error: "
+                  << result.message_ << std::endl;
+        return 1;
+    }
+
+    const size_t differences = CompareObjects(node_tree, streaming);
+    if (differences)
+        std::cerr << name << ": The object trees differ" << std::endl;
+
+    return differences;
+}
+
+}  // namespace
+
+int CheckFloatConversion(int count)
+{
+    std::vector<std::string> numbers(std::begin(kFloatEdgeCases),
+                                     std::end(kFloatEdgeCases));
+
+    // Fixed seed, so that a failure can be reproduced
+    std::mt19937 random(2024);
+    for (int i = 0; i < count; i++)
+        numbers.push_back(RandomDecimal(random));
+
+    size_t mismatches = 0;
+    std::vector<std::string> tokens;
+
+    for (const std::string& number : numbers)
+    {
+        // Numbers above the float range are not converted, subnormal
+        // numbers are
+        char* end;
+        errno = 0;
+        const float expected = std::strtof(number.c_str(), &end);
+        const bool valid = end != number.c_str() &&
+            !(errno == ERANGE && std::isinf(expected));
+
+        float value = 0.0f;
+        const bool converted = ConvertString(number, value);
+
+        if (converted != valid || (valid && !SameFloat(value, expected)))
+        {
+            std::cerr << "String \"" << number << "\" was converted to "
+                      << (converted ? FloatToString(value) : "nothing")
+                      << ", expected "
+                      << (valid ? FloatToString(expected) : "nothing")
+                      << std::endl;
+            mismatches++;
+        }
+
+        if (IsFloatToken(number))
+            tokens.push_back(number);
+    }
+
+    mismatches += CheckFloatTokens(tokens);
+
+    std::cout << numbers.size() << " strings, " << tokens.size()
+              << " tokens: " << mismatches << " mismatches" << std::endl;
+
+    return mismatches == 0 ? 0 : 1;
+}
+
+int CheckCompiledFiles(int count)
+{
+    const std::filesystem::path directory = GetBenchmarkDirectory();
+    const std::filesystem::path source   = directory / "document.ill";
+    const std::filesystem::path compiled = directory / "document.illc";
+    const std::filesystem::path damaged  = directory / "damaged.illc";
+
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+
+    if (!WriteFile(source, kCompiledFileDocument))
+    {
+        std::cerr << "Unable to write " << source << std::endl;
+        return 1;
+    }
+
+    gui::GlobalObject expected;
+    gui::ParserResult result =
+        gui::ParseFile(source.string().c_str(), expected);
+
+    if (result.type_ == gui::ParserResultType::kSuccess)
+    {
+        result = gui::CompileFile(source.string().c_str(),
+                                  compiled.string().c_str());
+    }
+
+    gui::GlobalObject loaded;
+    if (result.type_ == gui::ParserResultType::kSuccess)
+        result = gui::LoadCompiledFile(compiled.string().c_str(), loaded);
+
+    std::string data;
+    if (result.type_ != gui::ParserResultType::kSuccess ||
+        !ReadFile(compiled, data))
+    {
+        std::cerr << "Unable to compile and load the document:" << std::endl
+                  << result.ToString() << std::endl;
+        return 1;
+    }
+
+    size_t failures = CompareObjects(expected, loaded);
+
+    // Every section ends inside the file, so every truncated file has
+    // to be rejected
+    for (size_t size = 0; size < data.size(); size++)
+    {
+        if (!LoadDamagedFile(damaged, data.substr(0, size), true,
+                             "truncated"))
+        {
+            std::cerr << "Truncated to " << size << " of " << data.size()
+                      << " bytes" << std::endl;
+            failures++;
+        }
+    }
+
+    // Fixed seed, so that a failure can be reproduced
+    std::mt19937 random(2024);
+    std::uniform_int_distribution<size_t> position(0, data.size() - 1);
+    std::uniform_int_distribution<int> byte(0, 255);
+    std::uniform_int_distribution<int> byte_count(1, 4);
+
+    for (int i = 0; i < count; i++)
+    {
+        std::string corrupted = data;
+
+        const int changes = byte_count(random);
+        for (int j = 0; j < changes; j++)
+            corrupted[position(random)] = static_cast<char>(byte(random));
+
+        if (!LoadDamagedFile(damaged, corrupted, false, "corrupted"))
+        {
+            std::cerr << "Corruption number " << i << std::endl;
+            failures++;
+        }
+    }
+
+    std::filesystem::remove_all(directory, error);
+
+    std::cout << data.size() << " bytes, " << data.size()
+              << " truncated and " << count << " corrupted files: "
+              << failures << " failures" << std::endl;
+
+    return failures == 0 ? 0 : 1;
+}
+
+int CheckStreamingMode(int count)
+{
+    const std::filesystem::path directory = FindTestDirectory();
+    if (directory.empty())
+    {
+        std::cerr << "Unable to find the test files of the sandbox, run the "
+                     "benchmark inside the repository" << std::endl;
+        return 1;
+    }
+
+    std::vector<std::filesystem::path> files;
+    for (const auto& entry : std::filesystem::directory_iterator(directory))
+    {
+        const std::filesystem::path extension = entry.path().extension();
+        if (extension == ".ill" || extension == ".ills")
+            files.push_back(entry.path());
+    }
+
+    std::sort(files.begin(), files.end());
+
+    size_t failures = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        for (const std::filesystem::path& file : files)
+        {
+            failures += CompareParserModes(file.string(),
+                [&](gui::GlobalObject& dest, gui::ParserMode mode)
+                {
+                    return gui::ParseFile(file.string().c_str(), dest, mode);
+                });
+        }
+
+        for (size_t j = 0; j < std::size(kStreamingErrorCases); j++)
+        {
+            const std::string_view data = kStreamingErrorCases[j];
+
+            failures += CompareParserModes(
+                "Error case " + std::to_string(j),
+                [&](gui::GlobalObject& dest, gui::ParserMode mode)
+                {
+                    return gui::ParseData(data, dest, mode);
+                });
+        }
+    }
+
+    std::cout << files.size() << " files, "
+              << std::size(kStreamingErrorCases) << " error cases, " << count
+              << " runs: " << failures << " failures" << std::endl;
+
+    return failures == 0 ? 0 : 1;
+}
+
+}  // namespace benchmark
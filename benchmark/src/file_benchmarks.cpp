@@ -0,0 +1,302 @@
+#include "imgui.h"
+#include "imgui_markup.h"
+
+#include "benchmarks.h"
+
+#if defined(_PLATFORM_LINUX)
+    #include <fcntl.h>
+    #include <sys/resource.h>
+    #include <unistd.h>
+#elif defined(_PLATFORM_WINDOWS)
+    #include <windows.h>
+    #include <psapi.h>
+#endif  // _PLATFORM_LINUX
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+
+namespace gui = imgui_markup;
+
+namespace benchmark
+{
+
+namespace
+{
+
+constexpr size_t kObjectCount = 50000;
+
+using Clock = std::chrono::steady_clock;
+using Milliseconds = std::chrono::duration<double, std::milli>;
+
+double ToMiB(size_t kib)
+{
+    return kib / 1024.0;
+}
+
+/**
+ * Writes the file again and removes it from the page cache, so that the
+ * next load has to read it from the disk like the first load after a
+ * reboot. On windows the file is only written again.
+ */
+bool RecreateFile(const std::filesystem::path& path, const std::string& data)
+{
+    std::error_code error;
+    std::filesystem::remove(path, error);
+
+    if (!WriteFile(path, data))
+        return false;
+
+#if defined(_PLATFORM_LINUX)
+    const int file = open(path.c_str(), O_RDONLY);
+    if (file < 0)
+        return false;
+
+    // Dirty pages can not be dropped, they have to be written first
+    fdatasync(file);
+    posix_fadvise(file, 0, 0, POSIX_FADV_DONTNEED);
+    close(file);
+#endif  // _PLATFORM_LINUX
+
+    return true;
+}
+
+struct LoadTimes
+{
+    Milliseconds total{ 0 };
+    Milliseconds fastest{ 0 };
+    int runs = 0;
+
+    void Add(Milliseconds duration)
+    {
+        fastest = runs == 0 ? duration : std::min(fastest, duration);
+        total += duration;
+        runs++;
+    }
+};
+
+/**
+ * Loads the file into a new global object and adds the time to the times.
+ *
+ * @return false if the file could not be loaded.
+ */
+template<typename LoadFunction>
+bool TimeLoad(const std::filesystem::path& path, const std::string& data,
+              LoadFunction load, LoadTimes& times)
+{
+    if (!RecreateFile(path, data))
+    {
+        std::cerr << "Unable to write " << path << std::endl;
+        return false;
+    }
+
+    gui::GlobalObject global_object;
+
+    const auto start = Clock::now();
+    const gui::ParserResult result =
+        load(path.string().c_str(), global_object);
+    const Milliseconds duration = Clock::now() - start;
+
+    if (result.type_ != gui::ParserResultType::kSuccess)
+    {
+        std::cerr << "Unable to load " << path << ":" << std::endl
+                  << result.ToString() << std::endl;
+        return false;
+    }
+
+    times.Add(duration);
+
+    return true;
+}
+
+}  // namespace
+
+std::filesystem::path GetBenchmarkDirectory()
+{
+    return std::filesystem::temp_directory_path() / "imgui_markup_benchmark";
+}
+
+bool WriteFile(const std::filesystem::path& path, const std::string& data)
+{
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(data.data(), static_cast<std::streamsize>(data.size()));
+
+    return static_cast<bool>(file);
+}
+
+bool ReadFile(const std::filesystem::path& path, std::string& dest)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+        return false;
+
+    dest.assign(std::istreambuf_iterator<char>(file),
+                std::istreambuf_iterator<char>());
+
+    return true;
+}
+
+size_t GetPeakMemoryUsage()
+{
+#if defined(_PLATFORM_LINUX)
+    rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+
+    // Linux reports the size in KiB
+    return static_cast<size_t>(usage.ru_maxrss);
+#elif defined(_PLATFORM_WINDOWS)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters,
+                              sizeof(counters)))
+    {
+        return 0;
+    }
+
+    return counters.PeakWorkingSetSize / 1024;
+#else
+    return 0;
+#endif  // _PLATFORM_LINUX
+}
+
+int RunParseBenchmark(int count)
+{
+    const std::filesystem::path directory = GetBenchmarkDirectory();
+    const std::filesystem::path path = directory / "objects.ill";
+
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+
+    size_t file_size = 0;
+    {
+        // The document is released before parsing, so that it is not
+        // part of the peak memory usage of the parser
+        const std::string markup = BuildObjectDocument(kObjectCount);
+        file_size = markup.size();
+
+        if (!WriteFile(path, markup))
+        {
+            std::cerr << "Unable to write " << path << std::endl;
+            return 1;
+        }
+    }
+
+    const size_t memory_before = GetPeakMemoryUsage();
+
+    Milliseconds total(0);
+    Milliseconds fastest(0);
+
+    for (int i = 0; i < count; i++)
+    {
+        gui::GlobalObject global_object;
+
+        const auto start = Clock::now();
+        const gui::ParserResult result =
+            gui::ParseFile(path.string().c_str(), global_object);
+        const Milliseconds duration = Clock::now() - start;
+
+        if (result.type_ != gui::ParserResultType::kSuccess)
+        {
+            std::cerr << "Unable to parse the object document:" << std::endl
+                      << result.ToString() << std::endl;
+            std::filesystem::remove_all(directory, error);
+            return 1;
+        }
+
+        total += duration;
+        fastest = i == 0 ? duration : std::min(fastest, duration);
+    }
+
+    const size_t memory_after = GetPeakMemoryUsage();
+
+    std::filesystem::remove_all(directory, error);
+
+    std::cout << kObjectCount << " objects, " << file_size / 1024
+              << " KiB, " << count << " runs: " << total.count() / count
+              << " ms per parse, fastest " << fastest.count() << " ms"
+              << std::endl;
+    std::cout << "Peak RSS: " << ToMiB(memory_after) << " MiB, "
+              << ToMiB(memory_before) << " MiB before parsing" << std::endl;
+
+    return 0;
+}
+
+int RunColdStartBenchmark(int count)
+{
+    const std::filesystem::path directory = GetBenchmarkDirectory();
+    const std::filesystem::path source   = directory / "objects.ill";
+    const std::filesystem::path compiled = directory / "objects.illc";
+
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+
+    const std::string markup = BuildObjectDocument(kObjectCount);
+
+    std::string image;
+    if (!WriteFile(source, markup))
+    {
+        std::cerr << "Unable to write " << source << std::endl;
+        return 1;
+    }
+
+    const gui::ParserResult result = gui::CompileFile(
+        source.string().c_str(), compiled.string().c_str());
+
+    if (result.type_ != gui::ParserResultType::kSuccess ||
+        !ReadFile(compiled, image))
+    {
+        std::cerr << "Unable to compile the object document:" << std::endl
+                  << result.ToString() << std::endl;
+        std::filesystem::remove_all(directory, error);
+        return 1;
+    }
+
+    const auto parse_file = [](const char* path,
+                               gui::GlobalObject& global_object)
+    {
+        return gui::ParseFile(path, global_object);
+    };
+
+    LoadTimes parse_times;
+    LoadTimes load_times;
+
+    // The loads alternate, so that neither of them always runs on the
+    // memory that the other one released
+    bool success = true;
+    for (int i = 0; i < count && success; i++)
+    {
+        if (i % 2 == 0)
+        {
+            success = TimeLoad(source, markup, parse_file, parse_times) &&
+                TimeLoad(compiled, image, &gui::LoadCompiledFile, load_times);
+        }
+        else
+        {
+            success =
+                TimeLoad(compiled, image, &gui::LoadCompiledFile, load_times) &&
+                TimeLoad(source, markup, parse_file, parse_times);
+        }
+    }
+
+    std::filesystem::remove_all(directory, error);
+
+    if (!success)
+        return 1;
+
+    std::cout << kObjectCount << " objects, " << markup.size() / 1024
+              << " KiB source, " << image.size() / 1024 << " KiB compiled, "
+              << count << " runs:" << std::endl;
+    std::cout << "ParseFile:        " << parse_times.total.count() / count
+              << " ms per load, fastest " << parse_times.fastest.count()
+              << " ms" << std::endl;
+    std::cout << "LoadCompiledFile: " << load_times.total.count() / count
+              << " ms per load, fastest " << load_times.fastest.count()
+              << " ms" << std::endl;
+
+    return 0;
+}
+
+}  // namespace benchmark
@@ -0,0 +1,246 @@
+#include "imgui.h"
+#include "imgui_markup.h"
+
+#include "benchmarks.h"
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+namespace gui = imgui_markup;
+
+namespace benchmark
+{
+
+namespace
+{
+
+constexpr size_t kTextCount = 10000;
+constexpr size_t kWidgetGroupCount = 100;
+constexpr int kWarmUpFrameCount = 10;
+
+/**
+ * Button that is hovered and held by the mouse while the allocations are
+ * counted, see CheckFrameAllocations.
+ */
+constexpr const char* kHoveredButtonID = "panel_0.child_panel.button";
+
+/**
+ * Builds a document with a single panel containing kTextCount text
+ * objects, every fourth text has a color.
+ */
+std::string BuildTextDocument()
+{
+    std::string markup;
+    markup.reserve(kTextCount * 96);
+
+    markup += "Panel : panel\n{\n";
+    markup += "    position = (0, 0)\n";
+    markup += "    size     = (1280, 720)\n";
+    markup += "    title    = \"benchmark\"\n";
+
+    for (size_t i = 0; i < kTextCount; i++)
+    {
+        markup += "    Text\n    {\n";
+        markup += "        text = \"Text object number ";
+        markup += std::to_string(i);
+        markup += "\"\n";
+
+        if (i % 4 == 0)
+            markup += "        color = (1.0, 0.5, 0.25, 1.0)\n";
+
+        markup += "    }\n";
+    }
+
+    markup += "}\n";
+
+    return markup;
+}
+
+/**
+ * Builds a document containing every object type that is updated every
+ * frame: panels with child panels, containers, texts and styled buttons.
+ */
+std::string BuildWidgetDocument()
+{
+    std::string markup;
+
+    for (size_t i = 0; i < kWidgetGroupCount; i++)
+    {
+        const std::string index = std::to_string(i);
+
+        markup += "Panel : panel_" + index + "\n{\n";
+        markup += "    position = (" + std::to_string(i % 10 * 120) + ", " +
+                  std::to_string(i / 10 * 70) + ")\n";
+        markup += "    size     = (120, 70)\n";
+        markup += "    ChildPanel : child_panel\n    {\n";
+        markup += "        size = (100, 50)\n";
+        markup += "        Container\n        {\n";
+        markup += "            Text { text = \"Text " + index + "\" }\n";
+        markup += "            Button : button\n            {\n";
+        markup += "                text = \"Button " + index + "\"\n";
+        markup += "                ButtonStyle\n                {\n";
+        markup += "                    color         = (0.5, 0.0, 0.0, 1.0)\n";
+        markup += "                    color_hovered = (0.0, 0.5, 0.0, 1.0)\n";
+        markup += "                    color_active  = (0.0, 0.0, 0.5, 1.0)\n";
+        markup += "                }\n";
+        markup += "            }\n";
+        markup += "        }\n";
+        markup += "    }\n";
+        markup += "}\n";
+    }
+
+    return markup;
+}
+
+/**
+ * Headless ImGui context. Nothing is drawn, so the frame time is the time
+ * of GlobalObject::Update and of building the ImGui draw lists.
+ */
+class HeadlessContext
+{
+public:
+    HeadlessContext()
+    {
+        ImGui::CreateContext();
+
+        ImGuiIO& io = ImGui::GetIO();
+        io.DisplaySize = ImVec2(1280, 720);
+        io.IniFilename = nullptr;
+
+        // The font atlas has to be built before the first frame, the
+        // texture itself is never uploaded
+        unsigned char* pixels;
+        int width, height;
+        io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+    }
+
+    ~HeadlessContext()
+    {
+        ImGui::DestroyContext();
+    }
+
+    HeadlessContext(const HeadlessContext&) = delete;
+    HeadlessContext& operator=(const HeadlessContext&) = delete;
+};
+
+/**
+ * Runs a single frame. Only the update of the global object is counted,
+ * see count_allocations.
+ */
+void RunFrame(gui::GlobalObject& global_object, bool count)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    io.DeltaTime = 1.0f / 60.0f;
+
+    ImGui::NewFrame();
+
+    count_allocations = count;
+    global_object.Update();
+    count_allocations = false;
+
+    ImGui::Render();
+}
+
+bool LoadDocument(const std::string& markup, gui::GlobalObject& dest)
+{
+    const gui::ParserResult result = gui::ParseData(markup, dest);
+
+    if (result.type_ != gui::ParserResultType::kSuccess)
+    {
+        std::cerr << "Unable to parse the benchmark document: " <<
+            std::endl << result.ToString() << std::endl;
+        return false;
+    }
+
+    // The first frames create the ImGui windows and the cached IDs
+    for (int i = 0; i < kWarmUpFrameCount; i++)
+        RunFrame(dest, false);
+
+    return true;
+}
+
+}  // namespace
+
+int RunFrameBenchmark(int count)
+{
+    HeadlessContext context;
+    gui::GlobalObject global_object;
+
+    if (!LoadDocument(BuildTextDocument(), global_object))
+        return 1;
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < count; i++)
+        RunFrame(global_object, false);
+
+    const std::chrono::duration<double, std::micro> duration =
+        std::chrono::steady_clock::now() - start;
+
+    std::cout << kTextCount << " text objects, " << count << " frames: "
+              << duration.count() / count << " us per frame" << std::endl;
+
+    return 0;
+}
+
+int CheckFrameAllocations(int count)
+{
+    HeadlessContext context;
+    gui::GlobalObject global_object;
+
+    if (!LoadDocument(BuildWidgetDocument(), global_object))
+        return 1;
+
+    const gui::ObjectHandle button =
+        global_object.GetObjectHandle(kHoveredButtonID);
+    if (button.Empty())
+    {
+        std::cerr << "The benchmark document has no object with the ID "
+                  << kHoveredButtonID << std::endl;
+        return 1;
+    }
+
+    // The mouse is held above the center of the button, so that the
+    // frames include the hover and active state of an interactive object.
+    // The position is only known after the first frames.
+    const gui::Object& object = *global_object.Get(button);
+    const gui::Float2& position = object.GetGlobalPosition();
+    const gui::Float2& size = object.GetSize();
+
+    ImGuiIO& io = ImGui::GetIO();
+    io.MousePos = ImVec2(position.x + size.x / 2, position.y + size.y / 2);
+    io.MouseDown[ImGuiMouseButton_Left] = true;
+
+    // The hover and press of the button begin during these frames
+    for (int i = 0; i < kWarmUpFrameCount; i++)
+        RunFrame(global_object, false);
+
+    allocation_count = 0;
+
+    for (int i = 0; i < count; i++)
+        RunFrame(global_object, true);
+
+    const uint64_t allocations = allocation_count;
+
+    std::cout << count << " frames with a hovered button: " << allocations
+              << " allocations" << std::endl;
+
+    if (!object.IsHovered())
+    {
+        std::cerr << "The button " << kHoveredButtonID
+                  << " was not hovered by the mouse" << std::endl;
+        return 1;
+    }
+
+    if (allocations != 0)
+    {
+        std::cerr << "GlobalObject::Update allocated memory in a steady "
+                     "state frame" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+}  // namespace benchmark
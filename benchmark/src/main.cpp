@@ -0,0 +1,150 @@
+#include "imgui.h"
+#include "imgui_markup.h"
+
+#include "benchmarks.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <new>
+
+namespace gui = imgui_markup;
+
+namespace benchmark
+{
+
+std::atomic<bool> count_allocations = false;
+std::atomic<uint64_t> allocation_count = 0;
+
+void* CountingAlloc(size_t size, void* /* user_data */)
+{
+    if (count_allocations.load(std::memory_order_relaxed))
+        allocation_count.fetch_add(1, std::memory_order_relaxed);
+
+    return std::malloc(size);
+}
+
+void CountingFree(void* pointer, void* /* user_data */)
+{
+    std::free(pointer);
+}
+
+}  // namespace benchmark
+
+/**
+ * Every heap allocation of the process is counted while counting is
+ * enabled, so that allocations of std containers and strings, which do
+ * not go through the allocator functions, are found as well.
+ */
+void* operator new(size_t size)
+{
+    void* pointer = benchmark::CountingAlloc(size ? size : 1, nullptr);
+    if (!pointer)
+        throw std::bad_alloc();
+
+    return pointer;
+}
+
+void operator delete(void* pointer) noexcept
+{
+    benchmark::CountingFree(pointer, nullptr);
+}
+
+void operator delete(void* pointer, size_t /* size */) noexcept
+{
+    benchmark::CountingFree(pointer, nullptr);
+}
+
+namespace
+{
+
+struct Mode
+{
+    const char* name;
+    int (*run)(int count);
+    int default_count;
+};
+
+constexpr Mode kModes[] = {
+    { "--frames",               &benchmark::RunFrameBenchmark,     1000 },
+    { "--check-allocations",    &benchmark::CheckFrameAllocations, 1000 },
+    { "--tokens",               &benchmark::RunTokenBenchmark,     20 },
+    { "--theme",                &benchmark::RunThemeBenchmark,     20 },
+    { "--numbers",              &benchmark::RunNumberBenchmark,    5 },
+    { "--parse-rss",            &benchmark::RunParseBenchmark,     5 },
+    { "--cold-start",           &benchmark::RunColdStartBenchmark, 5 },
+    { "--check-floats",         &benchmark::CheckFloatConversion,  100000 },
+    { "--check-compiled-files", &benchmark::CheckCompiledFiles,    1000 },
+    { "--check-streaming",      &benchmark::CheckStreamingMode,    2 }
+};
+
+}  // namespace
+
+/**
+ * Benchmarks and checks of the layer, using a headless ImGui context
+ * where frames are needed.
+ *
+ * Usage: benchmark [mode] [count]
+ *
+ * Modes:
+ * --frames               - Frame time of a document with 10k text objects,
+ *                          the default mode.
+ * --check-allocations    - Fails if a steady state frame of a document with
+ *                          every interactive object type allocates memory,
+ *                          while the mouse holds one of its buttons.
+ * --tokens               - Token throughput of the lexer.
+ * --theme                - Parse time of a colour-heavy theme document.
+ * --numbers              - Lexing and parse time of a million numbers.
+ * --parse-rss            - Parse time and peak RSS of a file with 50k
+ *                          objects.
+ * --cold-start           - Load time of the 50k object file as markup and as
+ *                          compiled file, read from the disk.
+ * --check-floats         - Fails if a float is converted differently than
+ *                          by std::strtof.
+ * --check-compiled-files - Fails if a compiled file does not round-trip or
+ *                          a damaged compiled file is not rejected.
+ * --check-streaming      - Fails if the streaming mode of the parser does
+ *                          not match the node tree mode for the test files
+ *                          of the sandbox and for documents with errors.
+ */
+int main(int argc, char** argv)
+{
+    int arg = 1;
+
+    const Mode* mode = &kModes[0];
+    if (arg < argc && std::strncmp(argv[arg], "--", 2) == 0)
+    {
+        mode = nullptr;
+        for (const Mode& candidate : kModes)
+        {
+            if (std::strcmp(argv[arg], candidate.name) == 0)
+                mode = &candidate;
+        }
+
+        arg++;
+    }
+
+    const int count = mode && arg < argc ?
+        std::atoi(argv[arg++]) : mode ? mode->default_count : 0;
+
+    if (!mode || arg < argc || count <= 0)
+    {
+        std::cerr << "Usage: " << argv[0] << " [mode] [count]" << std::endl;
+        std::cerr << "Modes:";
+        for (const Mode& candidate : kModes)
+            std::cerr << " " << candidate.name;
+        std::cerr << std::endl;
+
+        return 1;
+    }
+
+    // The allocations of ImGui and the layer are counted as well
+    ImGui::SetAllocatorFunctions(&benchmark::CountingAlloc,
+                                 &benchmark::CountingFree);
+    gui::SetAllocatorFunctions(&benchmark::CountingAlloc,
+                               &benchmark::CountingFree);
+
+    return mode->run(count);
+}
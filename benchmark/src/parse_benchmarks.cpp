@@ -0,0 +1,243 @@
+#include "imgui.h"
+#include "imgui_markup.h"
+#include "imgui_markup/parser/lexer.h"
+
+#include "benchmarks.h"
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+namespace gui = imgui_markup;
+
+namespace benchmark
+{
+
+namespace
+{
+
+constexpr size_t kThemeCount = 200;
+constexpr size_t kButtonsPerTheme = 8;
+
+// Every vector holds two int and two float literals
+constexpr size_t kNumberCount = 1000000;
+
+using Clock = std::chrono::steady_clock;
+using Milliseconds = std::chrono::duration<double, std::milli>;
+
+std::string BuildNumberDocument()
+{
+    std::string markup;
+
+    for (size_t i = 0; i < kNumberCount / 4; i++)
+    {
+        const std::string n = std::to_string(i);
+
+        markup += "Float4 { value = (" + n + ", 0." + n + ", -" + n +
+                  ", " + n + ".25) }\n";
+    }
+
+    return markup;
+}
+
+}  // namespace
+
+std::string BuildThemeDocument()
+{
+    std::string markup;
+
+    for (size_t i = 0; i < kThemeCount; i++)
+    {
+        const std::string theme = "theme_" + std::to_string(i);
+
+        // Palette of the theme, every colour is a vector literal
+        markup += "Panel : " + theme + "\n{\n";
+        markup += "    position = (10, 10)\n";
+        markup += "    size     = (310, 330)\n";
+        markup += "    Float : alpha { value = 0.75 }\n";
+        markup += "    Int   : width { value = 140 }\n";
+        markup += "    Button : primary\n    {\n";
+        markup += "        size = (140, 20)\n";
+        markup += "        ButtonStyle : style\n        {\n";
+        markup += "            color         = (0.26, 0.59, 0.98, 0.40)\n";
+        markup += "            color_hovered = (0.26, 0.59, 0.98, 1.00)\n";
+        markup += "            color_active  = (0.06, 0.53, 0.98, 1.00)\n";
+        markup += "        }\n";
+        markup += "    }\n";
+        markup += "}\n";
+
+        // Buttons using the palette through references and mixed vectors
+        markup += "Panel : " + theme + "_buttons\n{\n";
+
+        for (size_t j = 0; j < kButtonsPerTheme; j++)
+        {
+            markup += "    Button\n    {\n";
+            markup += "        size = (" + theme + ".width.value, 20)\n";
+            markup += "        ButtonStyle\n        {\n";
+            markup += "            color         = " + theme +
+                      ".primary.style.color\n";
+            markup += "            color_hovered = (1, 0.5, 0, " + theme +
+                      ".alpha.value)\n";
+            markup += "            color_active  = " + theme +
+                      ".primary.style.color_active\n";
+            markup += "        }\n";
+            markup += "    }\n";
+            markup += "    Text { text = \"text\" color = (0.9, 0.9, 0.9, 1) }\n";
+        }
+
+        markup += "}\n";
+    }
+
+    return markup;
+}
+
+std::string BuildObjectDocument(size_t object_count)
+{
+    std::string markup;
+
+    // Every panel adds five objects
+    for (size_t i = 0; i < object_count / 5; i++)
+    {
+        const std::string panel = "panel_" + std::to_string(i);
+
+        markup += "Panel : " + panel + "\n{\n";
+        markup += "    title    = \"Panel " + std::to_string(i) + "\"\n";
+        markup += "    position = (" + std::to_string(i % 1280) + ", 10.5)\n";
+        markup += "    size     = (300, 200)\n";
+        markup += "    Float : scale { value = 0.75 }\n";
+        markup += "    Text : label { text = \"Label\" "
+                  "color = (0.9, 0.9, 0.9, 1) }\n";
+        markup += "    Button : button\n    {\n";
+        markup += "        text = " + panel + ".label.text\n";
+        markup += "        size = (140, " + panel + ".scale.value)\n";
+        markup += "        ButtonStyle { color = (0.26, 0.59, 0.98, 0.4) }\n";
+        markup += "    }\n";
+        markup += "}\n";
+    }
+
+    return markup;
+}
+
+int RunTokenBenchmark(int count)
+{
+    const std::string markup = BuildThemeDocument();
+
+    gui::internal::parser::Lexer lexer;
+    size_t tokens = 0;
+
+    const auto start = Clock::now();
+
+    for (int i = 0; i < count; i++)
+    {
+        lexer.InitData(markup);
+
+        // The parser looks at the current and the next token after it
+        // took a token
+        gui::internal::parser::LexerToken token;
+        while (lexer.GetNextToken(token))
+        {
+            lexer.LookAhead(0);
+            lexer.LookAhead(1);
+
+            tokens++;
+        }
+    }
+
+    const Milliseconds duration = Clock::now() - start;
+
+    std::cout << tokens / count << " tokens, " << count << " runs: "
+              << duration.count() / count << " ms per run, "
+              << tokens / duration.count() / 1000.0 << " M tokens/s"
+              << std::endl;
+
+    return 0;
+}
+
+int RunThemeBenchmark(int count)
+{
+    const std::string markup = BuildThemeDocument();
+
+    gui::ParserSession session;
+    gui::GlobalObject global_object;
+
+    const auto start = Clock::now();
+
+    for (int i = 0; i < count; i++)
+    {
+        const gui::ParserResult result =
+            session.ParseData(markup, global_object);
+
+        if (result.type_ != gui::ParserResultType::kSuccess)
+        {
+            std::cerr << "Unable to parse the theme document: " <<
+                std::endl << result.ToString() << std::endl;
+            return 1;
+        }
+    }
+
+    const Milliseconds duration = Clock::now() - start;
+
+    std::cout << kThemeCount << " themes, " << markup.size() / 1024 <<
+        " KiB, " << count << " runs: " << duration.count() / count <<
+        " ms per parse" << std::endl;
+
+    return 0;
+}
+
+int RunNumberBenchmark(int count)
+{
+    const std::string markup = BuildNumberDocument();
+
+    gui::internal::parser::Lexer lexer;
+    size_t numbers = 0;
+
+    const auto lexer_start = Clock::now();
+
+    for (int i = 0; i < count; i++)
+    {
+        lexer.InitData(markup);
+
+        gui::internal::parser::LexerToken token;
+        while (lexer.GetNextToken(token))
+        {
+            if (token.type == gui::internal::parser::LexerTokenType::kInt ||
+                token.type == gui::internal::parser::LexerTokenType::kFloat)
+            {
+                numbers++;
+            }
+        }
+    }
+
+    const Milliseconds lexer_duration = Clock::now() - lexer_start;
+
+    gui::ParserSession session;
+    gui::GlobalObject global_object;
+
+    const auto parse_start = Clock::now();
+
+    for (int i = 0; i < count; i++)
+    {
+        const gui::ParserResult result =
+            session.ParseData(markup, global_object);
+
+        if (result.type_ != gui::ParserResultType::kSuccess)
+        {
+            std::cerr << "Unable to parse the number document: " <<
+                std::endl << result.ToString() << std::endl;
+            return 1;
+        }
+    }
+
+    const Milliseconds parse_duration = Clock::now() - parse_start;
+
+    std::cout << numbers / count << " numbers, " << markup.size() / 1024 <<
+        " KiB, " << count << " runs:" << std::endl;
+    std::cout << "Lexing:  " << lexer_duration.count() / count <<
+        " ms per run, including the conversion" << std::endl;
+    std::cout << "Parsing: " << parse_duration.count() / count <<
+        " ms per run, including the interpreter" << std::endl;
+
+    return 0;
+}
+
+}  // namespace benchmark
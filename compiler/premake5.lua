@@ -0,0 +1,47 @@
+--compiler
+
+project "compiler"
+    kind "ConsoleApp"
+    language "C++"
+    cppdialect "C++17"
+    staticruntime "off"
+
+    targetdir ("%{wks.location}/bin/" .. outputdir .. "/%{prj.name}")
+    objdir ("%{wks.location}/obj/" .. outputdir .. "/%{prj.name}")
+
+    files
+    {
+        "src/**.h",
+        "src/**.cpp"
+    }
+
+    includedirs
+    {
+        "%{wks.location}/compiler/src",
+        "%{include_dir.imgui_markup}",
+        "%{include_dir.imgui}"
+    }
+
+    links
+    {
+        "imgui_markup",
+        "imgui"
+    }
+
+    filter "system:windows"
+        systemversion "latest"
+        defines "_PLATFORM_WINDOWS"
+
+    filter "system:linux"
+        systemversion "latest"
+        defines "_PLATFORM_LINUX"
+        links
+        {
+            "pthread"
+        }
+
+    filter "configurations:Debug"
+        symbols "on"
+
+    filter "configurations:Release"
+        optimize "on"
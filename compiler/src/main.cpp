@@ -0,0 +1,44 @@
+#include "imgui.h"
+#include "imgui_markup.h"
+
+#include <filesystem>
+#include <iostream>
+#include <string>
+
+namespace gui = imgui_markup;
+namespace fs = std::filesystem;
+
+/**
+ * Compiles a markup file and every file it includes to a compiled
+ * file (.illc), which can be loaded with gui::LoadCompiledFile.
+ *
+ * Usage: compiler <input.ill> [output.illc]
+ * The output path defaults to the input path with the extension ".illc".
+ */
+int main(int argc, char** argv)
+{
+    if (argc < 2 || argc > 3)
+    {
+        std::cerr << "Usage: " << argv[0] << " <input.ill> [output.illc]"
+                  << std::endl;
+        return 1;
+    }
+
+    const std::string input = argv[1];
+    const std::string output = argc == 3 ?
+        argv[2] : fs::path(input).replace_extension(".illc").string();
+
+    const gui::ParserResult result =
+        gui::CompileFile(input.c_str(), output.c_str());
+
+    if (result.type_ != gui::ParserResultType::kSuccess)
+    {
+        std::cerr << "Unable to compile \"" << input << "\": " << std::endl <<
+            result.ToString() << std::endl;
+        return 1;
+    }
+
+    std::cout << input << " -> " << output << std::endl;
+
+    return 0;
+}
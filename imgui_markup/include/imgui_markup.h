@@ -13,6 +13,7 @@
  * of object attributes through the markup language.
 */
 #include "imgui_markup/attribute_types/attribute_type.h"
+#include "imgui_markup/attribute_types/attribute_value.h"
 #include "imgui_markup/attribute_types/bool.h"
 #include "imgui_markup/attribute_types/float.h"
 #include "imgui_markup/attribute_types/float2.h"
@@ -39,6 +40,8 @@
 #include "imgui_markup/objects/attribute_types/object_int.h"
 #include "imgui_markup/objects/attribute_types/object_string.h"
 
+#include "imgui_markup/parser/parser_session.h"
+#include "imgui_markup/common/memory.h"
 #include "imgui_markup/common_functions.h"
 
 #endif  // IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_IMGUI_MARKUP_H_
@@ -1,6 +1,7 @@
 #ifndef IMGUI_MARKUP_INCLUDE_ATTRIBUTE_TYPES_ATTRIBUTE_TYPE_H_
 #define IMGUI_MARKUP_INCLUDE_ATTRIBUTE_TYPES_ATTRIBUTE_TYPE_H_
 
+#include "imgui_markup/attribute_types/attribute_value.h"
 #include "imgui_markup/parser/parser_result.h"
 
 #include <string>
@@ -27,6 +28,12 @@ class Float4;
 class Int;
 class String;
 
+/**
+ * Base of the attribute types. An attribute is a typed view of a value
+ * that is stored inside an object. Values are read and written as an
+ * AttributeValue, which selects the conversion from the conversion
+ * matrix, so the attribute types do not have any virtual functions.
+ */
 class Attribute
 {
 public:
@@ -40,45 +47,31 @@ public:
     bool value_changed_ = false;
 
     /**
-     * Loads a string value into the attribute.
+     * Loads a value into the attribute. The value is converted to the
+     * type of the attribute, see AttributeValue::ConvertTo.
      *
      * @param value that will be loaded into the attribute.
      * @return true on sucess
      * @return false if there was a conversion error
      */
+    bool LoadValue(const AttributeValue& value);
     bool LoadValue(const Attribute& value);
-    bool LoadValue(const Bool& value);
-    bool LoadValue(const Float& value);
-    bool LoadValue(const Float2& value);
-    bool LoadValue(const Float3& value);
-    bool LoadValue(const Float4& value);
-    bool LoadValue(const Int& value);
-    bool LoadValue(const String& value);
+
+    /**
+     * Copies the value of the attribute.
+     */
+    AttributeValue GetValue() const;
 
     /**
      * Converts the attribute value type to a std::string.
      */
-    virtual std::string ToString() const = 0;
+    std::string ToString() const;
 
 private:
-    // NOTE: typename T has to be an imgui_layer attribute!
-    template<typename T>
-    bool LoadValue(const T& value)
-    {
-        if (!this->IMPL_LoadValue(value))
-            return false;
-
-        this->value_changed_ = true;
-        return true;
-    }
-
-    virtual bool IMPL_LoadValue(const Bool& value)   { return false; }
-    virtual bool IMPL_LoadValue(const Float& value)  { return false; }
-    virtual bool IMPL_LoadValue(const Float2& value) { return false; }
-    virtual bool IMPL_LoadValue(const Float3& value) { return false; }
-    virtual bool IMPL_LoadValue(const Float4& value) { return false; }
-    virtual bool IMPL_LoadValue(const Int& value)    { return false; }
-    virtual bool IMPL_LoadValue(const String& value) = 0;
+    /**
+     * Stores a value of the same type as the attribute.
+     */
+    void StoreValue(const AttributeValue& value);
 };
 
 }  // namespace imgui_markup
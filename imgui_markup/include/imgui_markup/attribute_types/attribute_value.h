@@ -0,0 +1,87 @@
+#ifndef IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_ATTRIBUTE_TYPES_ATTRIBUTE_VALUE_H_
+#define IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_ATTRIBUTE_TYPES_ATTRIBUTE_VALUE_H_
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <variant>
+
+namespace imgui_markup
+{
+
+enum class AttributeType;
+
+/**
+ * Value of an attribute, stored by value. The index of the stored
+ * alternative is the AttributeType of the value, so a value can be passed
+ * around without allocating an attribute object, e.g. the result of a
+ * value node of the interpreter.
+ */
+class AttributeValue
+{
+public:
+    using Vector2 = std::array<float, 2>;
+    using Vector3 = std::array<float, 3>;
+    using Vector4 = std::array<float, 4>;
+
+    /**
+     * Alternatives in the order of the AttributeType enum.
+     */
+    using Storage = std::variant<
+        bool, float, Vector2, Vector3, Vector4, int, std::string>;
+
+    /**
+     * Number of attribute types.
+     */
+    static constexpr size_t kTypeCount = std::variant_size_v<Storage>;
+
+    AttributeValue() = default;
+    explicit AttributeValue(bool value)          : value_(value) { }
+    explicit AttributeValue(float value)         : value_(value) { }
+    explicit AttributeValue(const Vector2& value) : value_(value) { }
+    explicit AttributeValue(const Vector3& value) : value_(value) { }
+    explicit AttributeValue(const Vector4& value) : value_(value) { }
+    explicit AttributeValue(int value)           : value_(value) { }
+    explicit AttributeValue(std::string value)
+        : value_(std::move(value))
+    { }
+
+    AttributeType GetType() const;
+
+    /**
+     * Gets the stored value. T has to be the type that is stored.
+     */
+    template<typename T>
+    inline const T& Get() const { return std::get<T>(this->value_); }
+
+    /**
+     * Converts the value to another attribute type. The conversion is
+     * taken from the conversion matrix, see IsConvertible.
+     *
+     * @param type - Attribute type of the result.
+     * @param dest - Receives the converted value.
+     * @return false if the types can not be converted or the value is not
+     *         valid for the type, e.g. the string "abc" to a Float.
+     */
+    bool ConvertTo(AttributeType type, AttributeValue& dest) const;
+
+    /**
+     * Converts the value type to a std::string.
+     */
+    std::string ToString() const;
+
+    /**
+     * Checks if the conversion matrix contains a conversion between the
+     * two types. Every type can be converted to itself and to a String,
+     * and a String can be converted to every type.
+     */
+    static bool IsConvertible(AttributeType from, AttributeType to);
+
+private:
+    Storage value_;
+};
+
+}  // namespace imgui_markup
+
+#endif  // IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_ATTRIBUTE_TYPES_ATTRIBUTE_VALUE_H_
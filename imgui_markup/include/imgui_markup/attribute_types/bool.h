@@ -12,18 +12,14 @@ namespace imgui_markup
 class Bool : public Attribute
 {
 public:
+    static constexpr AttributeType kType = AttributeType::kBool;
+
     Bool();
     Bool(const bool b);
 
     bool value = true;
 
-    std::string ToString() const;
-
     inline operator bool() const { return value; }
-
-private:
-    bool IMPL_LoadValue(const Bool& value);
-    bool IMPL_LoadValue(const String& value);
 };
 
 }  // namespace imgui_markup
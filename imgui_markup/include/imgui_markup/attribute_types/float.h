@@ -12,18 +12,14 @@ namespace imgui_markup
 class Float : public Attribute
 {
 public:
+    static constexpr AttributeType kType = AttributeType::kFloat;
+
     Float();
     Float(float f);
 
     float value = 0;
 
-    std::string ToString() const;
-
     inline operator float() const { return value; }
-
-private:
-    bool IMPL_LoadValue(const Float& value);
-    bool IMPL_LoadValue(const String& value);
 };
 
 }
@@ -13,14 +13,14 @@ namespace imgui_markup
 class Float2 : public Attribute
 {
 public:
+    static constexpr AttributeType kType = AttributeType::kFloat2;
+
     Float2();
     Float2(float x, float y);
     Float2(ImVec2 vec);
 
-    Float x = 0;
-    Float y = 0;
-
-    std::string ToString() const;
+    float x = 0;
+    float y = 0;
 
     inline operator ImVec2() const { return ImVec2(x, y); }
     inline bool operator==(const Float2& right) const
@@ -33,11 +33,6 @@ public:
     {
         return !(*this == right);
     }
-
-private:
-    bool IMPL_LoadValue(const Float2& value);
-    bool IMPL_LoadValue(const String& value);
-    void Reset();
 };
 
 }  // namespace imgui_markup
@@ -13,14 +13,14 @@ namespace imgui_markup
 class Float3 : public Attribute
 {
 public:
+    static constexpr AttributeType kType = AttributeType::kFloat3;
+
     Float3();
     Float3(float x, float y, float z);
 
-    Float x = 0;
-    Float y = 0;
-    Float z = 0;
-
-    std::string ToString() const;
+    float x = 0;
+    float y = 0;
+    float z = 0;
 
     inline bool operator==(const Float3& right) const
     {
@@ -32,10 +32,6 @@ public:
     {
         return !(*this == right);
     }
-
-private:
-    bool IMPL_LoadValue(const Float3& value);
-    bool IMPL_LoadValue(const String& value);
 };
 
 }  // namespace imgui_markup
@@ -13,16 +13,16 @@ namespace imgui_markup
 class Float4 : public Attribute
 {
 public:
+    static constexpr AttributeType kType = AttributeType::kFloat4;
+
     Float4();
     Float4(float x, float y, float z, float w);
     Float4(ImVec4 vec);
 
-    Float x = 0;
-    Float y = 0;
-    Float z = 0;
-    Float w = 0;
-
-    std::string ToString() const;
+    float x = 0;
+    float y = 0;
+    float z = 0;
+    float w = 0;
 
     inline operator ImVec4() const { return ImVec4(x, y, z, w); }
 
@@ -36,10 +36,6 @@ public:
     {
         return !(*this == right);
     }
-
-private:
-    bool IMPL_LoadValue(const Float4& value);
-    bool IMPL_LoadValue(const String& value);
 };
 
 }  // namespace imgui_markup
@@ -12,18 +12,14 @@ namespace imgui_markup
 class Int : public Attribute
 {
 public:
+    static constexpr AttributeType kType = AttributeType::kInt;
+
     Int();
     Int(int i);
 
     int value = 0;
 
-    std::string ToString() const;
-
     inline operator int() const { return value; }
-
-private:
-    bool IMPL_LoadValue(const Int& value);
-    bool IMPL_LoadValue(const String& value);
 };
 
 }  // namespace imgui_markup
@@ -12,25 +12,16 @@ namespace imgui_markup
 class String : public Attribute
 {
 public:
+    static constexpr AttributeType kType = AttributeType::kString;
+
     String();
     String(std::string str);
     String(const char* str);
 
     std::string value;
 
-    std::string ToString() const;
-
     inline operator std::string() const { return value; }
     inline operator const char*() const { return value.c_str(); }
-
-private:
-    bool IMPL_LoadValue(const Bool& value);
-    bool IMPL_LoadValue(const Float& value);
-    bool IMPL_LoadValue(const Float2& value);
-    bool IMPL_LoadValue(const Float3& value);
-    bool IMPL_LoadValue(const Float4& value);
-    bool IMPL_LoadValue(const Int& value);
-    bool IMPL_LoadValue(const String& value);
 };
 
 }  // namespace imgui_markup
@@ -0,0 +1,148 @@
+#ifndef IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_COMMON_ATOM_H_
+#define IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_COMMON_ATOM_H_
+
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace imgui_markup
+{
+
+namespace atoms
+{
+
+/**
+ * Names that are known at compile time. They are inserted into the atom
+ * table before any other name, so that their atom IDs are fixed.
+ * The order has to match the names inside atom.cpp.
+ */
+enum Builtin : uint32_t
+{
+    kEmpty = 0,  // ""
+    kGlobal,     // "global"
+
+    // Object types
+    kGlobalObject,
+    kPanel,
+    kChildPanel,
+    kButton,
+    kButtonStyle,
+    kText,
+    kContainer,
+    kBool,
+    kFloat,
+    kFloat2,
+    kFloat3,
+    kFloat4,
+    kInt,
+    kString,
+
+    // Attribute names
+    kAttributeAuthor,
+    kAttributeBorder,
+    kAttributeColor,
+    kAttributeColorActive,
+    kAttributeColorHovered,
+    kAttributeDate,
+    kAttributeDescription,
+    kAttributeID,
+    kAttributePosition,
+    kAttributeSize,
+    kAttributeText,
+    kAttributeTitle,
+    kAttributeValue,
+    kAttributeVersion,
+
+    kBuiltinCount
+};
+
+}  // namespace atoms
+
+/**
+ * Thrown when a name is inserted into an atom table that already contains
+ * the maximum number of names.
+ */
+class AtomTableFull : public std::length_error
+{
+public:
+    AtomTableFull()
+        : std::length_error("Too many names inside the atom table")
+    { }
+};
+
+/**
+ * Interned name, e.g. an object type, object ID or attribute name.
+ * Every distinct name is stored only once inside a global atom table, so
+ * that atoms can be compared and hashed by their integer ID.
+ * Names are never removed from the table, which means that the string
+ * returned by an atom stays valid until the program exits.
+ * The atom table can be used from multiple threads.
+ */
+class Atom
+{
+public:
+    /**
+     * Creates an empty atom, which equals to the atom of "".
+     */
+    constexpr Atom() = default;
+
+    constexpr Atom(atoms::Builtin builtin)
+        : id_(builtin)
+    { }
+
+    /**
+     * Gets the atom of the given name. The name will be inserted into the
+     * atom table if it does not exists yet.
+     * Only names should be interned, e.g. a single segment of an object ID,
+     * because the table never shrinks.
+     *
+     * @throws AtomTableFull if the name has to be inserted into a full table.
+     */
+    explicit Atom(std::string_view name);
+
+    /**
+     * Looks up the atom of the given name without inserting it.
+     * Should be used for names that are passed in by the user at runtime,
+     * where an unknown name can not match any existing atom.
+     *
+     * @return true if the name exists inside the atom table.
+     */
+    static bool Find(std::string_view name, Atom& dest);
+
+    /**
+     * Returns the name of the atom.
+     */
+    const std::string& String() const;
+
+    inline std::string_view View()  const { return this->String(); }
+    inline uint32_t         GetID() const { return this->id_; }
+    inline bool             Empty() const { return this->id_ == atoms::kEmpty; }
+
+    inline bool operator==(const Atom& other) const
+        { return this->id_ == other.id_; }
+    inline bool operator!=(const Atom& other) const
+        { return this->id_ != other.id_; }
+
+private:
+    uint32_t id_ = atoms::kEmpty;
+};
+
+}  // namespace imgui_markup
+
+namespace std
+{
+
+template<>
+struct hash<imgui_markup::Atom>
+{
+    size_t operator()(const imgui_markup::Atom& atom) const noexcept
+    {
+        return atom.GetID();
+    }
+};
+
+}  // namespace std
+
+#endif  // IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_COMMON_ATOM_H_
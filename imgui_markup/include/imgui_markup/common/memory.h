@@ -0,0 +1,345 @@
+#ifndef IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_COMMON_MEMORY_H_
+#define IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_COMMON_MEMORY_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace imgui_markup
+{
+
+/**
+ * Parts of the layer that allocate memory through the allocator functions.
+ * Every subsystem has its own memory statistics.
+ * Strings, e.g. the values of attributes and the paths of files, are
+ * std::string inside the interface of the layer. They are allocated
+ * through the global heap and are not part of the statistics.
+ */
+enum class MemorySubsystem : uint8_t
+{
+    kLexer,        // File content and cached tokens of included files
+    kParser,       // Node trees of the parser
+    kInterpreter,  // Temporary data while a node tree is interpreted
+    kObjects,      // Object trees and object references
+    kUser,         // Memory of the application, see GetMemoryResource
+
+    kCount
+};
+
+/**
+ * Functions used to allocate and free the memory of the layer.
+ * The allocated memory has to be aligned for every scalar type, like the
+ * memory returned by malloc. The allocate function returns nullptr if
+ * there is not enough memory.
+ */
+using MemoryAllocFunction = void* (*)(size_t size, void* user_data);
+using MemoryFreeFunction  = void (*)(void* pointer, void* user_data);
+
+/**
+ * Counters of a memory subsystem since the process was started, see
+ * GetMemoryStatistics.
+ */
+struct MemoryStatistics
+{
+    /**
+     * Number of calls to the allocate and free functions.
+     */
+    uint64_t allocations = 0;
+    uint64_t frees = 0;
+
+    /**
+     * Bytes that are currently allocated and the highest number of bytes
+     * that were allocated at the same time.
+     */
+    uint64_t bytes_in_use = 0;
+    uint64_t peak_bytes_in_use = 0;
+};
+
+/**
+ * Sets the functions that are used for every allocation of the layer,
+ * similar to ImGui::SetAllocatorFunctions. The default functions use
+ * malloc and free.
+ * The functions should be set before any file is parsed, because memory
+ * is freed with the functions that are set at the time it is freed.
+ *
+ * @param alloc_function - Allocates memory, can be called from multiple
+ *                         threads at the same time, see ParseFiles.
+ * @param free_function  - Frees memory returned by alloc_function.
+ * @param user_data      - Passed to both functions.
+ */
+void SetAllocatorFunctions(MemoryAllocFunction alloc_function,
+                           MemoryFreeFunction free_function,
+                           void* user_data = nullptr);
+
+/**
+ * Gets the functions set by SetAllocatorFunctions.
+ */
+void GetAllocatorFunctions(MemoryAllocFunction* alloc_function,
+                           MemoryFreeFunction* free_function,
+                           void** user_data);
+
+/**
+ * Gets the allocation counters of a subsystem.
+ */
+MemoryStatistics GetMemoryStatistics(MemorySubsystem subsystem);
+
+/**
+ * Resets the allocation and free counters of every subsystem. The bytes
+ * in use are kept, the peak is set to the bytes in use.
+ */
+void ResetMemoryStatistics();
+
+/**
+ * Gets a memory resource that allocates through the allocator functions
+ * and is counted as the given subsystem. Used to store data of the
+ * application, e.g. inside std::pmr containers, in the same memory as
+ * the layer. The resources are never destroyed.
+ */
+std::pmr::memory_resource* GetMemoryResource(
+    MemorySubsystem subsystem = MemorySubsystem::kUser);
+
+namespace internal
+{
+
+/**
+ * Allocates and frees memory through the allocator functions.
+ *
+ * @throws std::bad_alloc if the allocate function returns nullptr.
+ */
+void* MemoryAlloc(size_t size, MemorySubsystem subsystem);
+void  MemoryFree(void* pointer, size_t size,
+                 MemorySubsystem subsystem) noexcept;
+
+/**
+ * Allocator of the standard containers that allocates through the
+ * allocator functions. The allocator is stateless, so that containers
+ * do not get larger.
+ */
+template<typename T, MemorySubsystem kSubsystem>
+class MemoryAllocator
+{
+public:
+    static_assert(alignof(T) <= alignof(std::max_align_t),
+                  "over-aligned types are not supported");
+
+    using value_type = T;
+
+    template<typename U>
+    struct rebind
+    {
+        using other = MemoryAllocator<U, kSubsystem>;
+    };
+
+    MemoryAllocator() noexcept = default;
+
+    template<typename U>
+    MemoryAllocator(const MemoryAllocator<U, kSubsystem>&) noexcept
+    { }
+
+    inline T* allocate(size_t count)
+    {
+        return static_cast<T*>(MemoryAlloc(count * sizeof(T), kSubsystem));
+    }
+
+    inline void deallocate(T* pointer, size_t count) noexcept
+    {
+        MemoryFree(pointer, count * sizeof(T), kSubsystem);
+    }
+
+    template<typename U>
+    inline bool operator==(const MemoryAllocator<U, kSubsystem>&) const
+        { return true; }
+    template<typename U>
+    inline bool operator!=(const MemoryAllocator<U, kSubsystem>&) const
+        { return false; }
+};
+
+/**
+ * Deleter of memory blocks created by AllocateBlock.
+ */
+template<MemorySubsystem kSubsystem>
+struct MemoryBlockDeleter
+{
+    size_t size = 0;
+
+    inline void operator()(void* pointer) const noexcept
+    {
+        MemoryFree(pointer, this->size, kSubsystem);
+    }
+};
+
+template<typename T, MemorySubsystem kSubsystem>
+using MemoryBlock = std::unique_ptr<T[], MemoryBlockDeleter<kSubsystem>>;
+
+/**
+ * Allocates uninitialized memory for count elements of a trivial type.
+ */
+template<typename T, MemorySubsystem kSubsystem>
+MemoryBlock<T, kSubsystem> AllocateBlock(size_t count)
+{
+    static_assert(std::is_trivial_v<T>, "T has to be a trivial type");
+    static_assert(alignof(T) <= alignof(std::max_align_t),
+                  "over-aligned types are not supported");
+
+    const size_t size = count * sizeof(T);
+
+    return MemoryBlock<T, kSubsystem>(
+        static_cast<T*>(MemoryAlloc(size, kSubsystem)),
+        MemoryBlockDeleter<kSubsystem>{ size });
+}
+
+/**
+ * Deleter of objects created by AllocateObject. The object may be deleted
+ * through a pointer to a base class with a virtual destructor, as long as
+ * the base class is at the beginning of the object, e.g. its only base.
+ */
+template<MemorySubsystem kSubsystem>
+struct MemoryObjectDeleter
+{
+    size_t size = 0;
+
+    template<typename T>
+    inline void operator()(T* pointer) const noexcept
+    {
+        pointer->~T();
+        MemoryFree(pointer, this->size, kSubsystem);
+    }
+};
+
+template<typename T, MemorySubsystem kSubsystem>
+using MemoryObject = std::unique_ptr<T, MemoryObjectDeleter<kSubsystem>>;
+
+/**
+ * Constructs a single object in memory allocated through the allocator
+ * functions, like std::make_unique.
+ */
+template<typename T, MemorySubsystem kSubsystem, typename... Args>
+MemoryObject<T, kSubsystem> AllocateObject(Args&&... args)
+{
+    static_assert(alignof(T) <= alignof(std::max_align_t),
+                  "over-aligned types are not supported");
+
+    void* memory = MemoryAlloc(sizeof(T), kSubsystem);
+
+    try
+    {
+        return MemoryObject<T, kSubsystem>(
+            new (memory) T(std::forward<Args>(args)...),
+            MemoryObjectDeleter<kSubsystem>{ sizeof(T) });
+    }
+    catch (...)
+    {
+        MemoryFree(memory, sizeof(T), kSubsystem);
+        throw;
+    }
+}
+
+/**
+ * Size class pool for small allocations of a single owner, e.g. the nodes
+ * of a std::unordered_map, which are otherwise allocated one at a time.
+ * Memory is taken from slabs that are allocated through the allocator
+ * functions, freed memory is kept in a free list per size class and
+ * reused. Allocations larger than the largest size class are passed to
+ * the allocator functions. The slabs are freed with the pool.
+ *
+ * The pool is not thread safe.
+ */
+class SlabPool
+{
+public:
+    explicit SlabPool(MemorySubsystem subsystem);
+    ~SlabPool();
+
+    SlabPool(const SlabPool&) = delete;
+    SlabPool& operator=(const SlabPool&) = delete;
+
+    void* Allocate(size_t size);
+    void  Free(void* pointer, size_t size) noexcept;
+
+private:
+    static constexpr size_t kGranularity = alignof(std::max_align_t);
+    static constexpr size_t kSizeClassCount = 16;
+    static constexpr size_t kSlabSize = 16 * 1024;
+
+    struct FreeSlot
+    {
+        FreeSlot* next;
+    };
+
+    MemorySubsystem subsystem_;
+
+    /**
+     * Freed memory of every size class. Size class i contains memory
+     * of (i + 1) * kGranularity bytes.
+     */
+    FreeSlot* free_lists_[kSizeClassCount] = { };
+
+    /**
+     * Every slab begins with a pointer to the previously allocated slab.
+     * cursor_ and end_ are the unused memory of the current slab.
+     */
+    char* slabs_  = nullptr;
+    char* cursor_ = nullptr;
+    char* end_    = nullptr;
+};
+
+/**
+ * Allocator of the standard containers that allocates through a SlabPool.
+ * The allocator is propagated with the container, so that the memory is
+ * always freed by the pool that allocated it.
+ */
+template<typename T>
+class SlabAllocator
+{
+public:
+    static_assert(alignof(T) <= alignof(std::max_align_t),
+                  "over-aligned types are not supported");
+
+    using value_type = T;
+
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    explicit SlabAllocator(SlabPool* pool) noexcept
+        : pool_(pool)
+    { }
+
+    template<typename U>
+    SlabAllocator(const SlabAllocator<U>& other) noexcept
+        : pool_(other.pool_)
+    { }
+
+    inline T* allocate(size_t count)
+    {
+        return static_cast<T*>(this->pool_->Allocate(count * sizeof(T)));
+    }
+
+    inline void deallocate(T* pointer, size_t count) noexcept
+    {
+        this->pool_->Free(pointer, count * sizeof(T));
+    }
+
+    template<typename U>
+    inline bool operator==(const SlabAllocator<U>& other) const
+        { return this->pool_ == other.pool_; }
+    template<typename U>
+    inline bool operator!=(const SlabAllocator<U>& other) const
+        { return this->pool_ != other.pool_; }
+
+private:
+    template<typename U>
+    friend class SlabAllocator;
+
+    SlabPool* pool_;
+};
+
+}  // namespace internal
+
+}  // namespace imgui_markup
+
+#endif  // IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_COMMON_MEMORY_H_
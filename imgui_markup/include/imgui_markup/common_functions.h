@@ -2,6 +2,7 @@
 #define IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_COMMON_FUNCTIONS_H_
 
 #include "imgui_markup/parser/parser.h"
+#include "imgui_markup/parser/parse_cache_statistics.h"
 
 namespace imgui_markup
 {
@@ -10,10 +11,15 @@ namespace imgui_markup
  * Parses a file containing the valid markup language used for the layer.
  * The parser will create a GlobalObject, which is the root of
  * the loaded file containing every object that was specified.
+ * Every call creates a new parser. Use a ParserSession when files are
+ * parsed repeatedly, e.g. when they are reloaded.
  *
  * @param[in] path - The path to the file that will get loaded.
  *                   Absolute and relative paths are allowed.
  * @param[out] global_object - Reference to a buffer receiving the loaded data.
+ * @param[in] mode - Defines how the parser passes the data to the
+ *                   interpreter. The streaming mode uses less memory for
+ *                   large files, see ParserMode.
  *
  * @return Result of the operation as a ParserResult, containing error type,
  *         message and line positions. If there was no error,
@@ -24,7 +30,133 @@ namespace imgui_markup
  *         and the global_object will be empty when an error occured while
  *         parsing the file.
  */
-ParserResult ParseFile(const char* path, GlobalObject& global_object);
+ParserResult ParseFile(const char* path, GlobalObject& global_object,
+                       ParserMode mode = ParserMode::kNodeTree);
+
+/**
+ * Parses multiple independent files at once. The files are distributed
+ * over the worker threads of the layer, the calling thread takes part in
+ * parsing the files as well. Every file is parsed the same way as by
+ * ParseFile, including the use of the parse cache.
+ * The function returns after every file was parsed.
+ *
+ * @param[in] paths - Paths of the files that will get loaded.
+ * @param[out] global_objects - Buffers receiving the loaded data, one
+ *                              buffer per path. Every buffer has to be
+ *                              different.
+ * @param[in] count - Number of paths and buffers.
+ * @param[in] mode - See ParseFile.
+ *
+ * @return The result of every file, in the same order as the paths.
+ *         See ParseFile.
+ * @throws Exceptions that are not caught by the parser, e.g.
+ *         std::bad_alloc, are rethrown after every file was processed.
+ */
+std::vector<ParserResult> ParseFiles(const char* const* paths,
+                                     GlobalObject* global_objects,
+                                     size_t count,
+                                     ParserMode mode = ParserMode::kNodeTree);
+
+/**
+ * Parses in-memory data containing the valid markup language used for
+ * the layer, e.g. markup that is embedded in the binary.
+ * The data is not copied. Paths of include instructions are relative to
+ * the current working directory.
+ *
+ * @param[in] data - The data that will get parsed.
+ * @param[out] global_object - Reference to a buffer receiving the loaded data.
+ * @param[in] mode - See ParseFile.
+ *
+ * @return Result of the operation as a ParserResult, see ParseFile.
+ */
+ParserResult ParseData(std::string_view data, GlobalObject& global_object,
+                       ParserMode mode = ParserMode::kNodeTree);
+
+/**
+ * Parses a file from a virtual filesystem containing the valid markup
+ * language used for the layer. Every include instruction is resolved
+ * through the virtual filesystem, the real filesystem is never accessed.
+ * The content of the files is not copied.
+ *
+ * @param[in] path - Path of the file inside the virtual filesystem.
+ * @param[in] files - The virtual filesystem.
+ * @param[out] global_object - Reference to a buffer receiving the loaded data.
+ * @param[in] mode - See ParseFile.
+ *
+ * @return Result of the operation as a ParserResult, see ParseFile.
+ */
+ParserResult ParseBuffers(const char* path, const VirtualFileSystem& files,
+                          GlobalObject& global_object,
+                          ParserMode mode = ParserMode::kNodeTree);
+
+/**
+ * Compiles a file containing the valid markup language to a binary file,
+ * which can be loaded with LoadCompiledFile. The compiled file contains
+ * the object tree of the file and every included file, so the markup
+ * does not have to be tokenized and interpreted when it is loaded.
+ * Compiled files can only be loaded by the same version of the layer
+ * and on machines with the same byte order.
+ *
+ * @param[in] path - The path to the file that will get compiled.
+ * @param[in] output_path - The path of the compiled file, normally using
+ *                          the extension ".illc". An existing file will
+ *                          be overwritten.
+ *
+ * @return Result of the operation as a ParserResult, see ParseFile.
+ *         ParserResultType::kUnableToWriteFile is returned if the
+ *         compiled file could not be written.
+ */
+ParserResult CompileFile(const char* path, const char* output_path);
+
+/**
+ * Loads a file that was compiled with CompileFile.
+ * On linux the file is memory mapped.
+ *
+ * @param[in] path - The path to the compiled file.
+ * @param[out] global_object - Reference to a buffer receiving the loaded data.
+ *
+ * @return Result of the operation as a ParserResult.
+ *         ParserResultType::kInvalidCompiledFile is returned if the file
+ *         is not a compiled file, is damaged or was compiled by a different
+ *         version. The global_object will be empty if there was an error.
+ */
+ParserResult LoadCompiledFile(const char* path, GlobalObject& global_object);
+
+/**
+ * Enables the on-disk parse cache, which is used by ParseFile.
+ * The object tree of every file that was parsed successfully is stored
+ * inside the cache directory. When the file is parsed again, the object
+ * tree is loaded from the cache instead, as long as the content of the
+ * file and every included file is the same.
+ * The cache is disabled by default.
+ *
+ * @param[in] directory - Directory of the cache, will be created if it
+ *                        does not exist. The directory should only be used
+ *                        by the parse cache.
+ * @param[in] max_size  - Maximum size of the cache directory in bytes.
+ *                        The least recently used files are removed if the
+ *                        size is exceeded.
+ */
+void EnableParseCache(const char* directory,
+                      uint64_t max_size = 64 * 1024 * 1024);
+
+/**
+ * Disables the parse cache. The cached files stay on disk.
+ */
+void DisableParseCache();
+
+/**
+ * Gets the hit and miss counters of the parse cache.
+ */
+ParseCacheStatistics GetParseCacheStatistics();
+
+/**
+ * Included files are tokenized once and cached for every following parse,
+ * as long as the file does not change on disk.
+ * Removes every file from the cache, e.g. to release the memory after
+ * every file was loaded.
+ */
+void ClearIncludeCache();
 
 }  // namespace imgui_markup
 
@@ -9,10 +9,13 @@ namespace imgui_markup
 
 struct ObjectBool : public Object
 {
-    ObjectBool(std::string id, Object* parent);
+    ObjectBool(Atom id, Object* parent);
 
     ObjectBool& operator=(const ObjectBool& other);
 
+    // See object.h for documentation
+    const AttributeTable& GetAttributeTable() const;
+
     Bool value;
 };
 
@@ -9,10 +9,13 @@ namespace imgui_markup
 
 struct ObjectFloat : public Object
 {
-    ObjectFloat(std::string id, Object* parent);
+    ObjectFloat(Atom id, Object* parent);
 
     ObjectFloat& operator=(const ObjectFloat& other);
 
+    // See object.h for documentation
+    const AttributeTable& GetAttributeTable() const;
+
     Float value;
 };
 
@@ -9,10 +9,13 @@ namespace imgui_markup
 
 struct ObjectFloat2 : public Object
 {
-    ObjectFloat2(std::string id, Object* parent);
+    ObjectFloat2(Atom id, Object* parent);
 
     ObjectFloat2& operator=(const ObjectFloat2& other);
 
+    // See object.h for documentation
+    const AttributeTable& GetAttributeTable() const;
+
     Float2 value;
 };
 
@@ -9,10 +9,13 @@ namespace imgui_markup
 
 struct ObjectFloat3 : public Object
 {
-    ObjectFloat3(std::string id, Object* parent);
+    ObjectFloat3(Atom id, Object* parent);
 
     ObjectFloat3& operator=(const ObjectFloat3& other);
 
+    // See object.h for documentation
+    const AttributeTable& GetAttributeTable() const;
+
     Float3 value;
 };
 
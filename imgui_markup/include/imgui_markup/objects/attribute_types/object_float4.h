@@ -9,10 +9,13 @@ namespace imgui_markup
 
 struct ObjectFloat4 : public Object
 {
-    ObjectFloat4(std::string id, Object* parent);
+    ObjectFloat4(Atom id, Object* parent);
 
     ObjectFloat4& operator=(const ObjectFloat4& other);
 
+    // See object.h for documentation
+    const AttributeTable& GetAttributeTable() const;
+
     Float4 value;
 };
 
@@ -9,10 +9,13 @@ namespace imgui_markup
 
 struct ObjectInt : public Object
 {
-    ObjectInt(std::string id, Object* parent);
+    ObjectInt(Atom id, Object* parent);
 
     ObjectInt& operator=(const ObjectInt& other);
 
+    // See object.h for documentation
+    const AttributeTable& GetAttributeTable() const;
+
     Int value;
 };
 
@@ -9,10 +9,13 @@ namespace imgui_markup
 
 struct ObjectString : public Object
 {
-    ObjectString(std::string id, Object* parent);
+    ObjectString(Atom id, Object* parent);
 
     ObjectString& operator=(const ObjectString& other);
 
+    // See object.h for documentation
+    const AttributeTable& GetAttributeTable() const;
+
     String value;
 };
 
@@ -15,10 +15,13 @@ class ButtonStyle;
 class Button : public Object
 {
 public:
-    Button(std::string id, Object* parent);
+    Button(Atom id, Object* parent);
 
     Button& operator=(const Button& other);
 
+    // See object.h for documentation
+    const AttributeTable& GetAttributeTable() const;
+
     void Update();
     bool IsPressed();
 
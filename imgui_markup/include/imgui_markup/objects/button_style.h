@@ -13,10 +13,13 @@ namespace imgui_markup
 class ButtonStyle : public Object
 {
 public:
-    ButtonStyle(std::string id, Object* parent);
+    ButtonStyle(Atom id, Object* parent);
 
     ButtonStyle& operator=(const ButtonStyle& other) = delete;
 
+    // See object.h for documentation
+    const AttributeTable& GetAttributeTable() const;
+
     Float4 color_;
     Float4 color_active_;
     Float4 color_hovered_;
@@ -13,10 +13,13 @@ class ChildPanel : public Object
 {
 public:
     // Constructor/Destructor
-    ChildPanel(std::string id, Object* parent);
+    ChildPanel(Atom id, Object* parent);
 
     ChildPanel& operator=(const ChildPanel& other);
 
+    // See object.h for documentation
+    const AttributeTable& GetAttributeTable() const;
+
     // Functions
     void Update();
 
@@ -0,0 +1,126 @@
+#ifndef IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_OBJECTS_COMMON_ATTRIBUTE_TABLE_H_
+#define IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_OBJECTS_COMMON_ATTRIBUTE_TABLE_H_
+
+#include "imgui_markup/common/atom.h"
+#include "imgui_markup/attribute_types/attribute_type.h"
+
+#include <cstdint>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace imgui_markup
+{
+
+class Object;
+
+/**
+ * Describes one attribute of an object type: its name, its type and how
+ * the attribute is found inside an object of the type.
+ */
+struct AttributeDescriptor
+{
+    Atom name;
+    AttributeType type;
+
+    /**
+     * Gets the attribute of the object. The object has to be of the type
+     * that the descriptor belongs to.
+     */
+    Attribute& (*access)(Object& object);
+};
+
+/**
+ * Creates the descriptor of an attribute that is a member of T.
+ *
+ * Example:
+ * DescribeAttribute<Button, &Button::text_>(atoms::kAttributeText)
+ */
+template<typename T, auto kMember>
+AttributeDescriptor DescribeAttribute(Atom name)
+{
+    using Member = std::decay_t<decltype(std::declval<T&>().*kMember)>;
+
+    return { name, Member::kType,
+        [](Object& object) -> Attribute&
+        { return static_cast<T&>(object).*kMember; } };
+}
+
+/**
+ * Attributes of one object type, which can be set through the markup
+ * language. Every object type has a single static table that is shared
+ * by every object of the type, see Object::GetAttributeTable.
+ *
+ * Attributes are looked up through a perfect hash of the name atom, so a
+ * lookup is a single multiplication and comparison.
+ */
+class AttributeTable
+{
+public:
+    /**
+     * Builds the table and searches a perfect hash for the names.
+     * Descriptors with a name that is already inside the table are
+     * ignored.
+     */
+    AttributeTable(std::initializer_list<AttributeDescriptor> descriptors);
+    explicit AttributeTable(std::vector<AttributeDescriptor> descriptors);
+
+    AttributeTable(const AttributeTable&) = delete;
+    AttributeTable& operator=(const AttributeTable&) = delete;
+
+    /**
+     * Gets the descriptor of an attribute by its name.
+     *
+     * @return pointer to the descriptor, nullptr if the table contains no
+     *         attribute with the name.
+     */
+    inline const AttributeDescriptor* Find(Atom name) const
+    {
+        const uint32_t slot = this->slots_[this->Hash(name)];
+        if (slot == kEmptySlot || this->descriptors_[slot].name != name)
+            return nullptr;
+
+        return &this->descriptors_[slot];
+    }
+
+    inline size_t Size() const { return this->descriptors_.size(); }
+
+    inline std::vector<AttributeDescriptor>::const_iterator begin() const
+        { return this->descriptors_.begin(); }
+    inline std::vector<AttributeDescriptor>::const_iterator end() const
+        { return this->descriptors_.end(); }
+
+private:
+    static constexpr uint32_t kEmptySlot = UINT32_MAX;
+
+    /**
+     * Descriptors in the order they were added.
+     */
+    std::vector<AttributeDescriptor> descriptors_;
+
+    /**
+     * Index into descriptors_ for every hash value, kEmptySlot if no name
+     * has the hash value.
+     */
+    std::vector<uint32_t> slots_;
+
+    uint32_t multiplier_ = 1;
+    uint32_t shift_ = 31;
+
+    inline uint32_t Hash(Atom name) const
+    {
+        return (name.GetID() * this->multiplier_) >> this->shift_;
+    }
+
+    /**
+     * Tries to place every name with the given hash parameters.
+     *
+     * @return false if two names have the same hash value.
+     */
+    bool BuildSlots(uint32_t multiplier, uint32_t bits);
+};
+
+}  // namespace imgui_markup
+
+#endif  // IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_OBJECTS_COMMON_ATTRIBUTE_TABLE_H_
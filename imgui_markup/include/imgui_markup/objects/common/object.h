@@ -1,21 +1,26 @@
 #ifndef IMGUI_MARKUP_SRC_OBJECTS_OBJECT_H_
 #define IMGUI_MARKUP_SRC_OBJECTS_OBJECT_H_
 
+#include "imgui_markup/common/atom.h"
 #include "imgui_markup/attribute_types/attribute_type.h"
 #include "imgui_markup/attribute_types/float2.h"
+#include "imgui_markup/objects/common/attribute_table.h"
+#include "imgui_markup/objects/common/object_event.h"
+#include "imgui_markup/objects/common/object_store.h"
 #include "imgui_markup/parser/parser_result.h"
 
 #include <string>
-#include <map>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
-#include <memory>
 
 namespace imgui_markup
 {
 
 namespace internal::parser
 {
-class Interpreter;  // Used as a friend class
+class Interpreter;   // Used as a friend class
+class CompiledFile;  // Used as a friend class
 }
 
 class Object
@@ -27,7 +32,7 @@ public:
      * @param[in] parent - Pointer to the parent object, nullptr
      *                     if the object has no parent object.
     */
-    Object(std::string type, std::string id, Object* parent);
+    Object(Atom type, Atom id, Object* parent);
 
     Object& operator=(const Object& other) = delete;
 
@@ -44,34 +49,59 @@ public:
      * @return a pointer to the attribute. nullptr, if the attribute with the
      *         given name does not exists.
     */
-    Attribute* GetAttribute(const std::string name) const;
+    Attribute* GetAttribute(Atom name) const;
+    Attribute* GetAttribute(std::string_view name) const;
+
+    /**
+     * Gets the attributes of the object type that can be set through the
+     * markup language. The table is shared by every object of the type.
+     */
+    virtual const AttributeTable& GetAttributeTable() const;
 
     /**
      * Sets the position attributes of the object.
      * NOTE: This function should only be used by other objects!
      *
+     * The positions are taken as ImVec2 and written into the position
+     * attributes, so no temporary attributes are created every frame.
+     *
      * @param draw_position - Main position that ImGui uses.
      * @param global_offset - Offset that is used to calculate the global
      *                        position.
      */
-    void SetPosition(Float2 draw_position, Float2 global_offset);
+    void SetPosition(const ImVec2& draw_position,
+                     const ImVec2& global_offset);
 
-    inline std::string GetID()           const   { return this->id_; }
-    inline std::string GetType()         const   { return this->type_; }
+    inline const std::string& GetID()   const   { return this->id_.String(); }
+    inline const std::string& GetType() const   { return this->type_.String(); }
+    inline Atom        GetIDAtom()       const   { return this->id_; }
+    inline Atom        GetTypeAtom()     const   { return this->type_; }
     inline Object*     GetParent()       const   { return this->parent_; }
     inline void        SetParent(Object* parent) { this->parent_ = parent; }
-    inline Float2      GetSize()         const   { return this->size_; }
-    inline Float2      GetDrawPosition() const
+    inline const Float2& GetSize()         const { return this->size_; }
+    inline const Float2& GetDrawPosition() const
         { return this->draw_position_; }
-    inline Float2      GetRelativePosition() const
+    inline const Float2& GetRelativePosition() const
         { return this->relative_position_; }
+    inline const Float2& GetGlobalPosition() const
+        { return this->global_position_; }
     inline bool        IsHovered() const { return this->is_hovered_; }
 
+    /**
+     * Gets the child objects, in the order they were created.
+     */
+    inline ObjectStore::ChildRange GetChildren() const
+    {
+        if (!this->store_)
+            return ObjectStore::ChildRange();
+
+        return this->store_->GetChildren(this->store_index_);
+    }
+
 protected:
-    std::string type_;
-    std::string id_;
+    Atom type_;
+    Atom id_;
     Object* parent_;
-    std::vector<std::shared_ptr<Object>> child_objects_ = { };
 
     /**
      * Main position that is relative to the parent object.
@@ -101,38 +131,41 @@ protected:
      */
     bool is_hovered_ = false;
 
-    // Functions
     /**
-     * Add an attribute to the attribute list.
-     *
-     * @param[in] name      - The name of the attribute, that can be used to
-     *                        access the attribute from data that is parsed.
-     * @param[in] attribute - An pointer to the attribute.
-    */
-    void AddAttribute(const std::string name, Attribute* attribute);
+     * Sets is_hovered_ and pushes the hover events of the object, and a
+     * kClicked event for every mouse button that was clicked while the
+     * object is hovered.
+     */
+    void SetHovered(bool hovered);
 
     /**
-     * Remove an attribute from the attribute list.
-     * Used to remove the default attributes that are added
-     * by this class.
-     *
-     * @param[in] name - The name of the attribute that will be removed.
-    */
-    void RemoveAttribute(const std::string name);
+     * Pushes an event into the event queue of the global object.
+     * Nothing is recorded if the object is not part of a global object.
+     */
+    void PushEvent(ObjectEventType type,
+                   ImGuiMouseButton button = ImGuiMouseButton_Left);
 
 private:
     friend class internal::parser::Interpreter;
+    friend class internal::parser::CompiledFile;
+    friend class ObjectStore;
+    friend class ObjectList;
+
+    /**
+     * Store that owns the object and its children, nullptr if the object
+     * was not created by a store.
+     */
+    ObjectStore* store_ = nullptr;
 
     /**
-     * List of the object attributes that can be set through
-     * the markup language.
+     * Index of the object inside the store.
      */
-    std::map<std::string, Attribute*> attribute_list_ = { };
+    ObjectStore::Index store_index_ = ObjectStore::kNone;
 
     /**
-     * Adds an child object to the child_objects_ variable.
+     * Adds an object of the same store as the last child object.
      */
-    void AddChild(std::shared_ptr<Object> child);
+    void AddChild(Object& child);
 
     /**
      * Verifys that the object is valid.
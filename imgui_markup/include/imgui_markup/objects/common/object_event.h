@@ -0,0 +1,82 @@
+#ifndef IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_OBJECTS_COMMON_OBJECT_EVENT_H_
+#define IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_OBJECTS_COMMON_OBJECT_EVENT_H_
+
+#include "imgui_markup/common/memory.h"
+#include "imgui_markup/objects/common/object_handle.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace imgui_markup
+{
+
+class Object;
+
+enum class ObjectEventType : uint8_t
+{
+    kHoverBegin,  // The mouse started hovering above the object
+    kHoverEnd,    // The mouse stopped hovering above the object
+    kClicked,     // A mouse button was clicked while the object is hovered
+    kPressed      // A button object was pressed, see ImGui::Button
+};
+
+/**
+ * Interaction with an object during the last update of its global object.
+ */
+struct ObjectEvent
+{
+    ObjectHandle object;
+    ObjectEventType type;
+
+    /**
+     * Mouse button of kClicked and kPressed events.
+     */
+    ImGuiMouseButton button;
+};
+
+/**
+ * Events of the objects of a global object. The objects push their events
+ * while they are updated, and the events are kept until the next update,
+ * see GlobalObject::GetEvents. The memory of the queue is kept, so
+ * pushing events does not allocate once the queue is large enough.
+ */
+class ObjectEventQueue
+{
+public:
+    ObjectEventQueue() = default;
+
+    ObjectEventQueue(const ObjectEventQueue&) = delete;
+    ObjectEventQueue& operator=(const ObjectEventQueue&) = delete;
+
+    /**
+     * Swaps the events and the generation of both queues.
+     */
+    void Swap(ObjectEventQueue& other) noexcept;
+
+    void Push(Object& object, ObjectEventType type,
+              ImGuiMouseButton button);
+
+    /**
+     * Removes every event. Handles of following events are created with
+     * the given generation of the global object.
+     */
+    void Clear(uint64_t generation);
+
+    inline const ObjectEvent* begin() const { return this->events_.data(); }
+    inline const ObjectEvent* end() const
+        { return this->events_.data() + this->events_.size(); }
+
+    inline size_t Size() const { return this->events_.size(); }
+    inline bool Empty() const { return this->events_.empty(); }
+
+private:
+    std::vector<ObjectEvent, internal::MemoryAllocator<
+        ObjectEvent, MemorySubsystem::kObjects>> events_;
+
+    uint64_t generation_ = 0;
+};
+
+}  // namespace imgui_markup
+
+#endif  // IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_OBJECTS_COMMON_OBJECT_EVENT_H_
@@ -0,0 +1,89 @@
+#ifndef IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_OBJECTS_COMMON_OBJECT_HANDLE_H_
+#define IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_OBJECTS_COMMON_OBJECT_HANDLE_H_
+
+#include <cstdint>
+
+namespace imgui_markup
+{
+
+class Attribute;
+class GlobalObject;
+class Object;
+class ObjectEventQueue;
+
+/**
+ * Reference to an object of a global object, which is resolved once from
+ * the full ID of the object, see GlobalObject::GetObjectHandle.
+ * Using a handle does not look up the ID again.
+ *
+ * A handle becomes invalid when the global object is reset, e.g. when a
+ * file is loaded into it. Invalid handles are ignored by the global
+ * object, so they have to be resolved again after a reload.
+ */
+class ObjectHandle
+{
+public:
+    ObjectHandle() = default;
+
+    /**
+     * Checks if the handle was resolved to an object. The handle can still
+     * be outdated, see GlobalObject::IsValid.
+     */
+    inline bool Empty() const { return !this->object_; }
+
+    /**
+     * Handles are equal if they were resolved to the same object by the
+     * same generation of a global object, e.g. to compare the object of
+     * an ObjectEvent with a handle.
+     */
+    inline bool operator==(const ObjectHandle& other) const
+    {
+        return this->object_ == other.object_ &&
+               this->generation_ == other.generation_;
+    }
+    inline bool operator!=(const ObjectHandle& other) const
+        { return !(*this == other); }
+
+private:
+    friend class GlobalObject;
+    friend class ObjectEventQueue;
+
+    Object* object_ = nullptr;
+
+    /**
+     * Generation of the global object when the handle was resolved.
+     */
+    uint64_t generation_ = 0;
+};
+
+/**
+ * Reference to an attribute of an object of a global object, which is
+ * resolved once from the full ID of the object and the attribute name,
+ * see GlobalObject::GetAttributeHandle.
+ * The handle is invalidated the same way as an ObjectHandle.
+ */
+class AttributeHandle
+{
+public:
+    AttributeHandle() = default;
+
+    /**
+     * Checks if the handle was resolved to an attribute. The handle can
+     * still be outdated, see GlobalObject::IsValid.
+     */
+    inline bool Empty() const { return !this->attribute_; }
+
+private:
+    friend class GlobalObject;
+
+    Attribute* attribute_ = nullptr;
+
+    /**
+     * Generation of the global object when the handle was resolved.
+     */
+    uint64_t generation_ = 0;
+};
+
+}  // namespace imgui_markup
+
+#endif  // IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_OBJECTS_COMMON_OBJECT_HANDLE_H_
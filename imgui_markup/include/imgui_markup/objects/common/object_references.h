@@ -0,0 +1,186 @@
+#ifndef IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_OBJECTS_COMMON_OBJECT_REFERENCES_H_
+#define IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_OBJECTS_COMMON_OBJECT_REFERENCES_H_
+
+#include "imgui_markup/common/atom.h"
+#include "imgui_markup/common/memory.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace imgui_markup
+{
+
+class Object;
+
+/**
+ * Index of every object with an ID, keyed by the full ID of the object.
+ * The full ID is the ID of the object, prefixed by the IDs of every
+ * parent object with an ID, separated by '.', e.g.
+ * "panel_0.child_panel.button_0".
+ *
+ * The index is a tree of ID segments. Every node is the child of the node
+ * of the previous segment, so a full ID is resolved in one walk over its
+ * segments, without building any strings. IDs containing '.' are split
+ * into multiple segments, which means that the object "b" inside the
+ * object "a" and a top level object with the ID "a.b" have the same
+ * full ID.
+ */
+class ObjectReferences
+{
+public:
+    using NodeIndex = uint32_t;
+
+    /**
+     * Node of the empty full ID, the scope of top level objects.
+     */
+    static constexpr NodeIndex kRoot = 0;
+
+    ObjectReferences();
+
+    /**
+     * The objects of both indices are swapped, so that the moved-from
+     * index stays usable.
+     */
+    ObjectReferences(ObjectReferences&& other);
+    ObjectReferences& operator=(ObjectReferences&& other) noexcept;
+
+    /**
+     * Adds an object to the index.
+     *
+     * @param scope  - Node of the nearest parent object with an ID,
+     *                 kRoot if there is no such object.
+     * @param id     - ID of the object.
+     * @param object - Object that is referenced by the full ID.
+     * @param dest   - Receives the node of the object, which is used as
+     *                 the scope of its child objects.
+     * @return false if an object with the same full ID already exists.
+     */
+    bool Insert(NodeIndex scope, Atom id, Object& object, NodeIndex& dest);
+
+    /**
+     * Adds an object to the index by an ID that was not interned, e.g. a
+     * full ID. Only the segments of the ID are interned.
+     */
+    bool Insert(NodeIndex scope, std::string_view id, Object& object,
+                NodeIndex& dest);
+
+    /**
+     * Gets an object by its full ID.
+     *
+     * @return pointer to the object, nullptr if the object does not exists.
+     */
+    Object* Find(std::string_view full_id) const;
+
+    /**
+     * Gets the object of the longest leading part of the path that is the
+     * full ID of an object, e.g. the object "panel_0.text_0" of the path
+     * "panel_0.text_0.position". The segments are resolved from left to
+     * right, until a segment does not belong to an object.
+     *
+     * @param length - Receives the length of the full ID of the object
+     *                 inside the path. 0 if there is no object.
+     * @return pointer to the object, nullptr if the first segment of the
+     *         path is not an object.
+     */
+    Object* FindLongestPrefix(std::string_view path, size_t& length) const;
+
+    /**
+     * Builds the full ID of a node.
+     */
+    std::string GetFullID(NodeIndex node) const;
+
+    /**
+     * Calls the function with the full ID of every object.
+     */
+    void ForEach(const std::function<
+        void(const std::string& full_id, Object& object)>& function) const;
+
+    /**
+     * Removes every object.
+     */
+    void Clear();
+
+    /**
+     * Reserves the memory for the given number of objects.
+     */
+    void Reserve(size_t count);
+
+    /**
+     * Gets the number of objects inside the index.
+     */
+    inline size_t Size() const { return this->size_; }
+
+private:
+    static constexpr MemorySubsystem kSubsystem = MemorySubsystem::kObjects;
+
+    struct Node
+    {
+        NodeIndex parent;
+        Atom segment;
+
+        /**
+         * nullptr if no object has this full ID, e.g. the node of the
+         * segment "a" of the ID "a.b".
+         */
+        Object* object;
+    };
+
+    /**
+     * Every node, the first node is the root.
+     */
+    std::vector<Node, internal::MemoryAllocator<Node, kSubsystem>> nodes_;
+
+    /**
+     * Memory of the entries of children_, which are allocated one at a
+     * time.
+     */
+    internal::MemoryObject<internal::SlabPool, kSubsystem> child_pool_;
+
+    /**
+     * Maps the parent node and the atom of a segment to the child node.
+     */
+    std::unordered_map<uint64_t, NodeIndex, std::hash<uint64_t>,
+        std::equal_to<uint64_t>, internal::SlabAllocator<
+            std::pair<const uint64_t, NodeIndex>>> children_;
+
+    /**
+     * Number of nodes that have an object.
+     */
+    size_t size_ = 0;
+
+    static inline uint64_t ChildKey(NodeIndex parent, Atom segment)
+    {
+        return static_cast<uint64_t>(parent) << 32 | segment.GetID();
+    }
+
+    /**
+     * Gets the child node of the segment, creating it if it does not exist.
+     */
+    NodeIndex AddChild(NodeIndex parent, Atom segment);
+
+    /**
+     * Gets the child node of the segment.
+     *
+     * @return false if the segment was never interned or the node does
+     *         not exist.
+     */
+    bool FindChild(NodeIndex parent, std::string_view segment,
+                   NodeIndex& dest) const;
+
+    /**
+     * Sets the object of a node.
+     *
+     * @return false if the node already has an object.
+     */
+    bool SetObject(NodeIndex node, Object& object);
+};
+
+}  // namespace imgui_markup
+
+#endif  // IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_OBJECTS_COMMON_OBJECT_REFERENCES_H_
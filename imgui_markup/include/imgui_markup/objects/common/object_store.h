@@ -0,0 +1,314 @@
+#ifndef IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_OBJECTS_COMMON_OBJECT_STORE_H_
+#define IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_OBJECTS_COMMON_OBJECT_STORE_H_
+
+#include "imgui_markup/common/atom.h"
+#include "imgui_markup/common/memory.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace imgui_markup
+{
+
+class Object;
+class ObjectEventQueue;
+
+/**
+ * Memory of every object of a single type. Objects are constructed inside
+ * fixed size chunks, so objects of the same type are next to each other
+ * in memory and creating an object does not allocate in most cases.
+ * The chunks are allocated through the allocator functions of the layer.
+ */
+class ObjectPoolBase
+{
+public:
+    virtual ~ObjectPoolBase() = default;
+
+    /**
+     * Destroys every object of the pool. The chunks are kept, so that the
+     * next objects are constructed inside the same memory.
+     */
+    virtual void Clear() = 0;
+
+    /**
+     * Frees the chunks that do not contain any object.
+     */
+    virtual void ReleaseMemory() = 0;
+};
+
+template<typename T>
+class ObjectPool : public ObjectPoolBase
+{
+public:
+    ObjectPool() = default;
+    ~ObjectPool() { this->Clear(); }
+
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
+    template<typename... Args>
+    T& Create(Args&&... args)
+    {
+        if (this->size_ == this->chunks_.size() * kChunkSize)
+        {
+            this->chunks_.push_back(
+                internal::AllocateBlock<Slot, kSubsystem>(kChunkSize));
+        }
+
+        Slot& slot = this->chunks_[this->size_ / kChunkSize]
+                                  [this->size_ % kChunkSize];
+
+        // The size is only increased if the constructor did not throw
+        T* object = new (slot.data) T(std::forward<Args>(args)...);
+        this->size_++;
+
+        return *object;
+    }
+
+    void Clear() override
+    {
+        for (size_t i = 0; i < this->size_; i++)
+        {
+            Slot& slot = this->chunks_[i / kChunkSize][i % kChunkSize];
+            std::launder(reinterpret_cast<T*>(slot.data))->~T();
+        }
+
+        this->size_ = 0;
+    }
+
+    void ReleaseMemory() override
+    {
+        this->chunks_.resize((this->size_ + kChunkSize - 1) / kChunkSize);
+    }
+
+private:
+    static constexpr size_t kChunkSize = 64;
+    static constexpr MemorySubsystem kSubsystem = MemorySubsystem::kObjects;
+
+    struct Slot
+    {
+        alignas(T) unsigned char data[sizeof(T)];
+    };
+
+    using Chunk = internal::MemoryBlock<Slot, kSubsystem>;
+
+    std::vector<Chunk, internal::MemoryAllocator<Chunk, kSubsystem>> chunks_;
+
+    /**
+     * Number of objects inside the pool.
+     */
+    size_t size_ = 0;
+};
+
+/**
+ * Owns every object of a document. Objects are allocated from one pool per
+ * object type, and the object tree is stored as index arrays, so that the
+ * tree is traversed without following a pointer per child.
+ *
+ * The first object is the root of the tree, which is not owned by the
+ * store, e.g. the global object.
+ */
+class ObjectStore
+{
+public:
+    using Index = uint32_t;
+
+    static constexpr Index kRoot = 0;
+    static constexpr Index kNone = UINT32_MAX;
+
+    /**
+     * Range over the child objects of an object, in the order the objects
+     * were added. The range is invalidated when an object is created.
+     */
+    class ChildRange
+    {
+    public:
+        class Iterator
+        {
+        public:
+            inline Object& operator*() const
+                { return *this->objects_[this->index_]; }
+            inline Object* operator->() const
+                { return this->objects_[this->index_]; }
+
+            inline Iterator& operator++()
+            {
+                this->index_ = this->next_sibling_[this->index_];
+                return *this;
+            }
+
+            inline bool operator==(const Iterator& other) const
+                { return this->index_ == other.index_; }
+            inline bool operator!=(const Iterator& other) const
+                { return this->index_ != other.index_; }
+
+        private:
+            friend class ChildRange;
+            friend class ObjectStore;
+
+            Object* const* objects_ = nullptr;
+            const Index* next_sibling_ = nullptr;
+            Index index_ = kNone;
+        };
+
+        ChildRange() = default;
+
+        inline Iterator begin() const { return this->begin_; }
+        inline Iterator end() const { return Iterator(); }
+
+        inline bool Empty() const { return this->begin_.index_ == kNone; }
+
+    private:
+        friend class ObjectStore;
+
+        Iterator begin_;
+    };
+
+    /**
+     * @param root   - Root of the tree, which has to outlive the store.
+     * @param events - Queue receiving the events of the objects, nullptr
+     *                 if events are not recorded.
+     */
+    explicit ObjectStore(Object& root, ObjectEventQueue* events = nullptr);
+
+    ObjectStore(const ObjectStore&) = delete;
+    ObjectStore& operator=(const ObjectStore&) = delete;
+
+    /**
+     * Swaps the objects of both stores. The roots and the event queues
+     * stay with their stores, the child objects of the roots are moved to
+     * the other root. The objects are not moved in memory, so pointers to
+     * them stay valid.
+     */
+    void Swap(ObjectStore& other) noexcept;
+
+    /**
+     * Constructs an object inside the pool of its type. The object is not
+     * part of the tree until it is added to a parent with AddChild.
+     *
+     * @param id     - ID of the object.
+     * @param parent - Parent object that is passed to the constructor.
+     */
+    template<typename T>
+    T& Create(Atom id, Object* parent)
+    {
+        const size_t pool_index = ObjectStore::GetPoolIndex<T>();
+
+        if (pool_index >= this->pools_.size())
+            this->pools_.resize(pool_index + 1);
+
+        Pool& pool = this->pools_[pool_index];
+        if (!pool)
+        {
+            pool = internal::AllocateObject<ObjectPool<T>,
+                                            MemorySubsystem::kObjects>();
+        }
+
+        T& object = static_cast<ObjectPool<T>&>(*pool).Create(id, parent);
+        this->Register(object);
+
+        return object;
+    }
+
+    /**
+     * Adds an object of the store as the last child of the parent.
+     */
+    void AddChild(Object& parent, Object& child);
+
+    /**
+     * Gets the child objects of the object with the given index.
+     */
+    inline ChildRange GetChildren(Index index) const
+    {
+        ChildRange range;
+        range.begin_.objects_      = this->objects_.data();
+        range.begin_.next_sibling_ = this->next_sibling_.data();
+        range.begin_.index_        = this->first_child_[index];
+        return range;
+    }
+
+    /**
+     * Destroys every object except the root. The memory of the pools is
+     * kept for the next objects, so no memory is freed or allocated.
+     */
+    void Clear();
+
+    /**
+     * Frees the memory that is not used by any object.
+     */
+    void ReleaseMemory();
+
+    /**
+     * Gets the number of objects, including the root.
+     */
+    inline size_t Size() const { return this->objects_.size(); }
+
+    /**
+     * Gets the queue receiving the events of the objects, nullptr if
+     * events are not recorded.
+     */
+    inline ObjectEventQueue* GetEventQueue() const { return this->events_; }
+
+private:
+    template<typename T>
+    using Vector = std::vector<
+        T, internal::MemoryAllocator<T, MemorySubsystem::kObjects>>;
+
+    /**
+     * Every object, indexed by its store index.
+     */
+    Vector<Object*> objects_;
+
+    /**
+     * Tree of the objects, kNone if there is no such object.
+     */
+    Vector<Index> first_child_;
+    Vector<Index> last_child_;
+    Vector<Index> next_sibling_;
+
+    ObjectEventQueue* events_;
+
+    /**
+     * Pools indexed by the pool index of their object type. Declared last,
+     * so that the objects are destroyed before the index arrays.
+     */
+    using Pool = internal::MemoryObject<ObjectPoolBase,
+                                        MemorySubsystem::kObjects>;
+    Vector<Pool> pools_;
+
+    /**
+     * Assigns the next store index to the object.
+     */
+    void Register(Object& object);
+
+    /**
+     * Sets the store of every object to this store, after the objects
+     * were taken from another store.
+     *
+     * @param previous_root - Root of the previous store, which is
+     *                        replaced as the parent by the root of
+     *                        this store.
+     */
+    void AdoptObjects(const Object* previous_root) noexcept;
+
+    /**
+     * Gets a process wide index of the object type T, which is the index
+     * of its pool inside every store.
+     */
+    template<typename T>
+    static size_t GetPoolIndex()
+    {
+        static const size_t index = ObjectStore::NextPoolIndex();
+        return index;
+    }
+
+    static size_t NextPoolIndex();
+};
+
+}  // namespace imgui_markup
+
+#endif  // IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_OBJECTS_COMMON_OBJECT_STORE_H_
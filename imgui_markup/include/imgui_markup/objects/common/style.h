@@ -6,6 +6,9 @@
 #include "imgui_markup/attribute_types/float2.h"
 #include "imgui_markup/attribute_types/float4.h"
 #include "imgui_markup/attribute_types/int.h"
+#include "imgui_markup/objects/common/attribute_table.h"
+
+#include <vector>
 
 namespace imgui_markup
 {
@@ -60,13 +63,132 @@ protected:
     Float  circle_tessellation_max_error_;
 
     // Functions
-    void AddStyleAttirbutes(std::map<std::string, Attribute*>& attribute_list);
+    /**
+     * Adds the descriptors of the style attributes to the descriptors of
+     * the object type T, which has to derive from Object and Style.
+     * The descriptors are only added once, when the attribute table of T
+     * is built.
+     */
+    template<typename T>
+    static void AddStyleAttributes(
+        std::vector<AttributeDescriptor>& descriptors);
 
-    void OverwriteName(std::map<std::string, Attribute*>& attribute_list,
-                       const std::string old_name,
-                       const std::string new_name);
+    /**
+     * Changes the name of a descriptor that was added by
+     * AddStyleAttributes.
+     */
+    static void OverwriteName(std::vector<AttributeDescriptor>& descriptors,
+                              Atom old_name, Atom new_name);
 };
 
+template<typename T>
+void Style::AddStyleAttributes(std::vector<AttributeDescriptor>& descriptors)
+{
+    descriptors.push_back(
+        DescribeAttribute<T, &T::alpha_>(Atom("alpha")));
+    descriptors.push_back(
+        DescribeAttribute<T, &T::disabled_alpha_>(Atom("disabled_alpha")));
+    descriptors.push_back(
+        DescribeAttribute<T, &T::window_padding_>(Atom("window_padding")));
+    descriptors.push_back(
+        DescribeAttribute<T, &T::window_rounding_>(Atom("window_rounding")));
+    descriptors.push_back(
+        DescribeAttribute<T, &T::window_border_size_>(
+            Atom("window_border_size")));
+    descriptors.push_back(
+        DescribeAttribute<T, &T::window_min_size_>(Atom("window_min_size")));
+    descriptors.push_back(
+        DescribeAttribute<T, &T::window_title_align_>(
+            Atom("window_title_align")));
+    descriptors.push_back(
+        DescribeAttribute<T, &T::window_menu_button_position_>(
+            Atom("window_menu_button_position")));
+    descriptors.push_back(
+        DescribeAttribute<T, &T::child_rounding_>(Atom("child_rounding")));
+    descriptors.push_back(
+        DescribeAttribute<T, &T::child_border_size_>(
+            Atom("child_border_size")));
+    descriptors.push_back(
+        DescribeAttribute<T, &T::popup_rounding_>(Atom("popup_rounding")));
+    descriptors.push_back(
+        DescribeAttribute<T, &T::popup_border_size_>(
+            Atom("popup_border_size")));
+    descriptors.push_back(
+        DescribeAttribute<T, &T::frame_padding_>(Atom("frame_padding")));
+    descriptors.push_back(
+        DescribeAttribute<T, &T::frame_rounding_>(Atom("frame_rounding")));
+    descriptors.push_back(
+        DescribeAttribute<T, &T::frame_border_size_>(
+            Atom("frame_border_size")));
+    descriptors.push_back(
+        DescribeAttribute<T, &T::item_spacing_>(Atom("item_spacing")));
+    descriptors.push_back(
+        DescribeAttribute<T, &T::item_inner_spacing_>(
+            Atom("item_inner_spacing")));
+    descriptors.push_back(
+        DescribeAttribute<T, &T::cell_padding_>(Atom("cell_padding")));
+    descriptors.push_back(
+        DescribeAttribute<T, &T::touch_extra_padding_>(
+            Atom("touch_extra_padding")));
+    descriptors.push_back(
+        DescribeAttribute<T, &T::indent_spacing_>(Atom("indent_spacing")));
+    descriptors.push_back(
+        DescribeAttribute<T, &T::columns_min_spacing_>(
+            Atom("columns_min_spacing")));
+    descriptors.push_back(
+        DescribeAttribute<T, &T::scrollbar_size_>(Atom("scrollbar_size")));
+    descriptors.push_back(
+        DescribeAttribute<T, &T::scrollbar_rounding_>(
+            Atom("scrollbar_rounding")));
+    descriptors.push_back(
+        DescribeAttribute<T, &T::grab_min_size_>(Atom("grab_min_size")));
+    descriptors.push_back(
+        DescribeAttribute<T, &T::grab_rounding_>(Atom("grab_rounding")));
+    descriptors.push_back(
+        DescribeAttribute<T, &T::log_slider_deadzone_>(
+            Atom("log_slider_deadzone")));
+    descriptors.push_back(
+        DescribeAttribute<T, &T::tab_rounding_>(Atom("tab_rounding")));
+    descriptors.push_back(
+        DescribeAttribute<T, &T::tab_border_size_>(Atom("tab_border_size")));
+    descriptors.push_back(
+        DescribeAttribute<T, &T::tab_min_width_for_close_button_>(
+            Atom("tab_min_width_for_close_button")));
+    descriptors.push_back(
+        DescribeAttribute<T, &T::color_button_position_>(
+            Atom("color_button_position")));
+    descriptors.push_back(
+        DescribeAttribute<T, &T::button_text_align_>(
+            Atom("button_text_align")));
+    descriptors.push_back(
+        DescribeAttribute<T, &T::selectable_text_align_>(
+            Atom("selectable_text_align")));
+    descriptors.push_back(
+        DescribeAttribute<T, &T::display_window_padding_>(
+            Atom("display_window_padding")));
+    descriptors.push_back(
+        DescribeAttribute<T, &T::display_safe_area_padding_>(
+            Atom("display_safe_area_padding")));
+    descriptors.push_back(
+        DescribeAttribute<T, &T::mouse_cursor_scale_>(
+            Atom("mouse_cursor_scale")));
+    descriptors.push_back(
+        DescribeAttribute<T, &T::anti_aliased_lines_>(
+            Atom("anti_aliased_lines")));
+    descriptors.push_back(
+        DescribeAttribute<T, &T::anti_aliased_lines_use_tex_>(
+            Atom("anti_aliased_lines_use_tex")));
+    descriptors.push_back(
+        DescribeAttribute<T, &T::anti_aliased_fill_>(
+            Atom("anti_aliased_fill")));
+    descriptors.push_back(
+        DescribeAttribute<T, &T::curve_tessellation_tol_>(
+            Atom("curve_tessellation_tol")));
+    descriptors.push_back(
+        DescribeAttribute<T, &T::circle_tessellation_max_error_>(
+            Atom("circle_tessellation_max_error")));
+}
+
 }  // namespace imgui_markup
 
 #endif  // IMGUI_MARKUP_SRC_OBJECTS_STYLE_H_
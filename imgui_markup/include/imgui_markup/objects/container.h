@@ -8,7 +8,7 @@ namespace imgui_markup
 
 struct Container : public Object
 {
-    Container(std::string id, Object* parent);
+    Container(Atom id, Object* parent);
 
     Container& operator=(const Container& other);
 
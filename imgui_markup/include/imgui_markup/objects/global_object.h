@@ -2,15 +2,23 @@
 #define IMGUI_MARKUP_SRC_OBJECTS_GLOBAL_OBJECT_H_
 
 #include "imgui_markup/objects/common/object.h"
+#include "imgui_markup/objects/common/object_event.h"
+#include "imgui_markup/objects/common/object_handle.h"
+#include "imgui_markup/objects/common/object_references.h"
 
 #include "imgui_markup/attribute_types/string.h"
 
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
 namespace imgui_markup
 {
 
 namespace internal::parser
 {
-class Interpreter;  // Used as a friend class
+class Interpreter;   // Used as a friend class
+class CompiledFile;  // Used as a friend class
 }
 
 class GlobalObject : public Object
@@ -24,15 +32,59 @@ public:
 
     GlobalObject();
 
+    /**
+     * Global objects can not be copied, but they can be moved, e.g. to
+     * store them inside a std::vector. The objects are not moved in
+     * memory, so handles resolved by the moved-from global object are
+     * valid for the new one. The moved-from global object receives the
+     * previous objects of the assigned global object.
+     * The move constructor is not noexcept, because it creates an empty
+     * global object for the moved-from object first, which allocates.
+     * A std::vector still moves the objects when it grows, but a
+     * std::bad_alloc during the growth leaves the vector in a valid but
+     * unspecified state. The move assignment only swaps and does not throw.
+     */
+    GlobalObject(GlobalObject&& other);
+    GlobalObject& operator=(GlobalObject&& other) noexcept;
+
     GlobalObject& operator=(const GlobalObject& other);
 
+    // See object.h for documentation
+    const AttributeTable& GetAttributeTable() const;
+
+    /**
+     * Updates every child object. The events of the previous update are
+     * removed, and the objects push their new events, see GetEvents.
+     */
     void Update();
 
     /**
-     * Resets every attribute from this object.
+     * Gets the events of the objects during the last update, e.g. buttons
+     * that were pressed. The objects of the events can be compared with
+     * handles resolved by GetObjectHandle.
+     *
+     * Example:
+     * for (const ObjectEvent& event : global_object.GetEvents())
+     * {
+     *     if (event.type == ObjectEventType::kPressed &&
+     *         event.object == button_handle)
+     *         ...
+     * }
+     */
+    inline const ObjectEventQueue& GetEvents() const { return this->events_; }
+
+    /**
+     * Resets every attribute from this object and destroys every child
+     * object. The memory of the objects is kept for the next file.
     */
     void Reset();
 
+    /**
+     * Frees the object memory that is not used by any object, e.g. after
+     * a large file was replaced by a small one.
+     */
+    void ReleaseMemory();
+
     /**
      * Checks if one or more of the child objects are hovered.
      */
@@ -43,7 +95,13 @@ public:
      * The function always returns false if the object with the given
      * ID does not exists.
      */
-    bool IsHovered(std::string object_id) const noexcept;
+    bool IsHovered(std::string_view object_id) const noexcept;
+
+    /**
+     * Checks if the object of the handle is hovered.
+     * The function always returns false if the handle is not valid.
+     */
+    bool IsHovered(const ObjectHandle& handle) const noexcept;
 
     /**
      * Checks if one or more of the child objects are pressed.
@@ -62,11 +120,118 @@ public:
      * @param button = Specifies the button that will be
      *                 checked if it is presed.
      */
-    bool IsPressed(std::string object_id,
+    bool IsPressed(std::string_view object_id,
+        ImGuiMouseButton button = ImGuiMouseButton_Left) const noexcept;
+
+    /**
+     * Checks if the object of the handle is pressed.
+     * The function always returns false if the handle is not valid.
+     *
+     * @param button = Specifies the button that will be
+     *                 checked if it is presed.
+     */
+    bool IsPressed(const ObjectHandle& handle,
         ImGuiMouseButton button = ImGuiMouseButton_Left) const noexcept;
 
+    /**
+     * Resolves the full ID of an object to a handle, which is used to
+     * access the object every frame without looking up the ID again.
+     *
+     * @param object_id - Full ID of the object, e.g. "panel_0.button_0".
+     * @return handle of the object, an empty handle if the object
+     *         does not exists.
+     */
+    ObjectHandle GetObjectHandle(std::string_view object_id) const noexcept;
+
+    /**
+     * Resolves an attribute of an object to a handle, which is used to
+     * read and write the attribute every frame without looking up the
+     * object and the attribute again.
+     *
+     * @param attribute_path - Full ID of the object followed by the name
+     *                         of the attribute, e.g.
+     *                         "panel_0.text_0.position".
+     * @return handle of the attribute, an empty handle if the object or
+     *         the attribute does not exists.
+     */
+    AttributeHandle GetAttributeHandle(
+        std::string_view attribute_path) const noexcept;
+
+    /**
+     * Checks if the handle was resolved by this global object and the
+     * object was not reset since.
+     */
+    inline bool IsValid(const ObjectHandle& handle) const noexcept
+    {
+        return handle.object_ && handle.generation_ == this->generation_;
+    }
+    inline bool IsValid(const AttributeHandle& handle) const noexcept
+    {
+        return handle.attribute_ && handle.generation_ == this->generation_;
+    }
+
+    /**
+     * Gets the object of the handle.
+     *
+     * @return pointer to the object, nullptr if the handle is not valid.
+     */
+    inline Object* Get(const ObjectHandle& handle) const noexcept
+    {
+        return this->IsValid(handle) ? handle.object_ : nullptr;
+    }
+
+    /**
+     * Gets the attribute of the handle, e.g. Get<Float2>(handle).
+     *
+     * @return pointer to the attribute, nullptr if the handle is not valid
+     *         or the attribute is not of the type T.
+     */
+    template<typename T>
+    inline const T* Get(const AttributeHandle& handle) const noexcept
+    {
+        static_assert(std::is_base_of_v<Attribute, T>,
+                      "T has to be an attribute type");
+
+        if (!this->IsValid(handle) || handle.attribute_->type != T::kType)
+            return nullptr;
+
+        return static_cast<const T*>(handle.attribute_);
+    }
+
+    /**
+     * Sets the attribute of the handle to a value of the same type, e.g.
+     * Set(handle, Float2(10, 20)).
+     *
+     * @return false if the handle is not valid or the attribute is not of
+     *         the type T.
+     */
+    template<typename T>
+    inline bool Set(const AttributeHandle& handle, const T& value) noexcept
+    {
+        static_assert(std::is_base_of_v<Attribute, T>,
+                      "T has to be an attribute type");
+
+        if (!this->IsValid(handle) || handle.attribute_->type != T::kType)
+            return false;
+
+        static_cast<T&>(*handle.attribute_) = value;
+        handle.attribute_->value_changed_ = true;
+
+        return true;
+    }
+
+    /**
+     * Sets the attribute of the handle to a value of any type, which is
+     * converted to the type of the attribute, see Attribute::LoadValue.
+     *
+     * @return false if the handle is not valid or the value could not be
+     *         converted.
+     */
+    bool Set(const AttributeHandle& handle, const AttributeValue& value);
+
 private:
     friend class internal::parser::Interpreter;
+    friend class internal::parser::CompiledFile;
 
     /**
      * Stores a reference to every child object with an ID.
@@ -95,7 +260,25 @@ private:
      * Will be stored as:
      * "panel_0.child_panel.button_0" -> Button
      */
-    std::map<std::string, Object&> object_references_;
+    ObjectReferences object_references_;
+
+    /**
+     * Events of the child objects, declared before the store, because
+     * the store refers to the queue.
+     */
+    ObjectEventQueue events_;
+
+    /**
+     * Owns every child object of the file.
+     */
+    ObjectStore object_store_;
+
+    /**
+     * Changed on every reset, so that the handles of the previous objects
+     * are not valid anymore. Taken from a process wide counter, so that
+     * handles of other global objects are never valid either.
+     */
+    uint64_t generation_;
 
     /**
      * Gets an object by its object ID from the object references.
@@ -103,12 +286,17 @@ private:
      * @param object_id - ID of the object that will be returned
      * @return pointer to object, nullptr if the object does not exists.
      */
-    Object* GetObjectReference(std::string object_id) const noexcept;
+    Object* GetObjectReference(std::string_view object_id) const noexcept;
 
     /**
      * Checks if the given object is hovered.
      */
     bool IsHovered(const Object& object) const noexcept;
+
+    /**
+     * Swaps the attributes, objects and events of both global objects.
+     */
+    void Swap(GlobalObject& other) noexcept;
 };
 
 }  // namespace imgui_markup
@@ -13,10 +13,13 @@ class Panel : public Object
 {
 public:
     // Constructor/Destructor
-    Panel(std::string id, Object* parent);
+    Panel(Atom id, Object* parent);
 
     Panel& operator=(const Panel& other);
 
+    // See object.h for documentation
+    const AttributeTable& GetAttributeTable() const;
+
     // Functions
     void Update();
 
@@ -14,10 +14,13 @@ class Text : public Object
 {
 public:
     // Constructor/Destructor
-    Text(std::string id, Object* parent);
+    Text(Atom id, Object* parent);
 
     Text& operator=(const Text& other);
 
+    // See object.h for documentation
+    const AttributeTable& GetAttributeTable() const;
+
     // Functions
     void Update();
 
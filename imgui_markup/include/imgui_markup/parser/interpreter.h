@@ -1,10 +1,13 @@
 #ifndef IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_PARSER_INTERPRETER_H_
 #define IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_PARSER_INTERPRETER_H_
 
+#include "imgui_markup/common/memory.h"
 #include "imgui_markup/parser/parser_result.h"
 #include "imgui_markup/parser/lexer.h"
 #include "imgui_markup/parser/parser_nodes.h"
 #include "imgui_markup/objects/global_object.h"
+#include "imgui_markup/objects/common/object_references.h"
+#include "imgui_markup/attribute_types/attribute_value.h"
 #include "imgui_markup/attribute_types/bool.h"
 #include "imgui_markup/attribute_types/float.h"
 #include "imgui_markup/attribute_types/float2.h"
@@ -14,6 +17,8 @@
 #include "imgui_markup/attribute_types/string.h"
 
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 #include <memory>
 
@@ -23,18 +28,23 @@ namespace imgui_markup::internal::parser
 struct InterpreterException
 {
     InterpreterException(
-        std::string message, ParserNode node, ParserResultType type)
-        : message(message), node(node), type(type)
+        std::string message, const ParserNode& node, ParserResultType type)
+        : message(message), location(node.location), type(type)
     { }
 
     const std::string message;
-    const ParserNode node;
+
+    /**
+     * Only the location of the node is stored, because the node itself
+     * is freed with the rest of the node tree.
+     */
+    const SourceLocation location;
     const ParserResultType type;
 };
 
 struct WrongBaseNode : public InterpreterException
 {
-    WrongBaseNode(ParserNode node)
+    WrongBaseNode(const ParserNode& node)
         : InterpreterException("Expected object or attribute definition", node,
                               ParserResultType::kWrongBaseNode)
     { }
@@ -42,7 +52,7 @@ struct WrongBaseNode : public InterpreterException
 
 struct UndefinedObjectType : public InterpreterException
 {
-    UndefinedObjectType(ParserNode node)
+    UndefinedObjectType(const ParserNode& node)
         : InterpreterException("Undefined object type", node,
                               ParserResultType::kUndefinedObjectType)
     { }
@@ -50,7 +60,7 @@ struct UndefinedObjectType : public InterpreterException
 
 struct MissingAttributeValue : public InterpreterException
 {
-    MissingAttributeValue(ParserNode node)
+    MissingAttributeValue(const ParserNode& node)
         : InterpreterException("Missing attribute value", node,
                               ParserResultType::kMissingAttributeValue)
     { }
@@ -58,7 +68,7 @@ struct MissingAttributeValue : public InterpreterException
 
 struct UnknownAttributeValueType : public InterpreterException
 {
-    UnknownAttributeValueType(ParserNode node)
+    UnknownAttributeValueType(const ParserNode& node)
         : InterpreterException("Wrong type of attribute value, "
                                "expecting string, number or vector", node,
                               ParserResultType::kUnknownAttributeValueType)
@@ -68,14 +78,14 @@ struct UnknownAttributeValueType : public InterpreterException
 struct AttributeConversionError : public InterpreterException
 {
     AttributeConversionError(std::string type_left, std::string type_right,
-                             std::string value, ParserNode node)
+                             std::string value, const ParserNode& node)
         : InterpreterException("Unable to convert \"" + value +
                                "\" of type \"" + type_right + "\" to a " +
                                "value of type: \"" + type_left + "\"", node,
                               ParserResultType::kAttributeConversionError)
     { }
     AttributeConversionError(std::string type_left,
-                             std::string value, ParserNode node)
+                             std::string value, const ParserNode& node)
         : InterpreterException("Unable to convert \"" + value + "\" to a " +
                                "value of type: \"" + type_left + "\"", node,
                               ParserResultType::kAttributeConversionError)
@@ -85,7 +95,7 @@ struct AttributeConversionError : public InterpreterException
 struct AttributeDoesNotExists : public InterpreterException
 {
     AttributeDoesNotExists(std::string object_type,
-                           std::string attribute_name, ParserNode node)
+                           std::string attribute_name, const ParserNode& node)
         : InterpreterException("Object of type \"" + object_type +
                                "\" has no attribute called \"" +
                                attribute_name + "\"",
@@ -95,7 +105,7 @@ struct AttributeDoesNotExists : public InterpreterException
 
 struct ObjectIDAlreadyDefined : public InterpreterException
 {
-    ObjectIDAlreadyDefined(std::string id, ParserNode node)
+    ObjectIDAlreadyDefined(std::string id, const ParserNode& node)
         : InterpreterException("Object with ID \"" + id +
                                "\" is already defined", node,
                               ParserResultType::kObjectIDAlreadyDefined)
@@ -104,7 +114,7 @@ struct ObjectIDAlreadyDefined : public InterpreterException
 
 struct ObjectIDGlobalIsReserved : public InterpreterException
 {
-    ObjectIDGlobalIsReserved(ParserNode node)
+    ObjectIDGlobalIsReserved(const ParserNode& node)
         : InterpreterException("Object ID \"global\" is reserved and cant "
                                "be used", node,
                               ParserResultType::kObjectIDGlobalIsReserved)
@@ -113,7 +123,7 @@ struct ObjectIDGlobalIsReserved : public InterpreterException
 
 struct InvalidObjectID : public InterpreterException
 {
-    InvalidObjectID(std::string object_id, ParserNode node)
+    InvalidObjectID(std::string object_id, const ParserNode& node)
         : InterpreterException("Object ID \"" + object_id + "\" is invalid",
                               node, ParserResultType::kObjectIsNotDefined)
     { }
@@ -122,7 +132,7 @@ struct InvalidObjectID : public InterpreterException
 
 struct ObjectIsNotDefined : public InterpreterException
 {
-    ObjectIsNotDefined(std::string object_id, ParserNode node)
+    ObjectIsNotDefined(std::string object_id, const ParserNode& node)
         : InterpreterException("Object with ID \"" + object_id + "\" "
                                "is not defined. Make sure to sepcify the "
                                "full ID", node,
@@ -132,7 +142,7 @@ struct ObjectIsNotDefined : public InterpreterException
 
 struct NoAttributeSpecified : public InterpreterException
 {
-    NoAttributeSpecified(ParserNode node)
+    NoAttributeSpecified(const ParserNode& node)
         : InterpreterException("Reference to objects is not supported", node,
                               ParserResultType::kNoAttributeSpecified)
     { }
@@ -140,7 +150,7 @@ struct NoAttributeSpecified : public InterpreterException
 
 struct ObjectIsNotValid : public InterpreterException
 {
-    ObjectIsNotValid(std::string error_message, ParserNode node)
+    ObjectIsNotValid(std::string error_message, const ParserNode& node)
         : InterpreterException(error_message, node,
                               ParserResultType::kObjectIsNotValid)
     { }
@@ -148,7 +158,7 @@ struct ObjectIsNotValid : public InterpreterException
 
 struct InternalWrongNodeType : public InterpreterException
 {
-    InternalWrongNodeType(ParserNode node)
+    InternalWrongNodeType(const ParserNode& node)
         : InterpreterException("Internal error: wrong node type", node,
                               ParserResultType::kInternalWrongNodeType)
     { }
@@ -174,8 +184,31 @@ public:
      *         The parser will only catch the interpreter exceptions.
      *         Every other exceptions is not catched by the parser!
      */
-    void ConvertNodeTree(const std::shared_ptr<ParserNode>& root_node,
-                         GlobalObject& dest);
+    void ConvertNodeTree(const ParserNode& root_node, GlobalObject& dest);
+
+    /**
+     * Functions used by the streaming mode of the parser. Instead of a
+     * complete node tree, the parser passes every object and attribute
+     * assign node to the interpreter as soon as it was parsed.
+     * The nodes are processed in the same order as ConvertNodeTree would
+     * process them, so the generated object tree and errors are the same.
+     *
+     * BeginStream has to be called before the first node and EndStream
+     * after the last node. Every StreamObjectBegin has to be followed by a
+     * StreamObjectEnd of the same node, after its child nodes were passed.
+     *
+     * @param node - Object or attribute assign node, which is only used
+     *               during the call. The child nodes of an object node
+     *               are ignored.
+     * @throws The function can throw interpreter and std exceptions.
+     *         The parser will only catch the interpreter exceptions.
+     *         Every other exceptions is not catched by the parser!
+     */
+    void BeginStream(const ParserNode& root_node, GlobalObject& dest);
+    void StreamObjectBegin(const ParserNode& node);
+    void StreamAttributeAssign(const ParserNode& node);
+    void StreamObjectEnd(const ParserNode& node);
+    void EndStream(GlobalObject& dest);
 
     /**
      * Resets the entire interpreter so it can be used on a new node tree.
@@ -210,7 +243,38 @@ private:
      * Will be stored as:
      * "panel_0.child_panel.button_0" -> Button
      */
-    std::map<std::string, Object&> object_references_;
+    ObjectReferences object_references_;
+
+    /**
+     * Objects of the object nodes that are currently processed by
+     * the streaming mode. The last object is the current parent object.
+     */
+    std::vector<Object*,
+        MemoryAllocator<Object*, MemorySubsystem::kInterpreter>>
+        object_stack_;
+
+    /**
+     * Node inside the object references of every object that is
+     * currently processed, or the node of its nearest parent object
+     * with an ID. Used so that the full ID of a new object is not built
+     * from the IDs of every parent object.
+     */
+    std::vector<ObjectReferences::NodeIndex,
+        MemoryAllocator<ObjectReferences::NodeIndex,
+                        MemorySubsystem::kInterpreter>> reference_scopes_;
+
+    /**
+     * Number of references of the last object tree. Used to reserve the
+     * object references when the interpreter is used multiple times,
+     * e.g. when the same file is reloaded.
+     */
+    size_t reference_count_hint_ = 0;
+
+    /**
+     * Passes the object references to the global object of the
+     * generated object tree.
+     */
+    void MoveObjectReferences(GlobalObject& dest);
 
     /**
      * Adds the object to the object references.
@@ -255,6 +319,26 @@ private:
      */
     void ProcessObjectNode(const ParserNode& node, Object& parent_object);
 
+    /**
+     * Creates the object of an object node inside the parent object.
+     * The child nodes of the node are not processed.
+     *
+     * @return The created object, which is owned by the parent object.
+     * @throws The function can throw interpreter and std exceptions.
+     *         The parser will only catch the interpreter exceptions.
+     *         Every other exceptions is not catched by the parser!
+     */
+    Object& BeginObjectNode(const ParserNode& node, Object& parent_object);
+
+    /**
+     * Finishes an object after its child nodes were processed.
+     *
+     * @throws The function can throw interpreter and std exceptions.
+     *         The parser will only catch the interpreter exceptions.
+     *         Every other exceptions is not catched by the parser!
+     */
+    void EndObjectNode(const ParserNode& node, Object& object);
+
     /**
      * Changes the defined attribute of the parent_object to the
      * defined value.
@@ -270,6 +354,18 @@ private:
     void ProcessAttributeAssignNode(
         const ParserNode& node, Object& parent_object);
 
+    /**
+     * Loads the value into the attribute of the parent_object that is
+     * defined by the attribute assign node.
+     *
+     * @throws The function can throw interpreter and std exceptions.
+     *         The parser will only catch the interpreter exceptions.
+     *         Every other exceptions is not catched by the parser!
+     */
+    void AssignAttributeValue(const ParserAttributeAssignNode& node,
+                              Object& parent_object,
+                              const AttributeValue& value) const;
+
     /**
      * Converts a string node to its value as a string.
      *
@@ -277,53 +373,81 @@ private:
      *         The parser will only catch the interpreter exceptions.
      *         Every other exceptions is not catched by the parser!
      */
-    String ProcessStringNode(const ParserNode& node) const;
+    AttributeValue ProcessStringNode(const ParserNode& node) const;
 
     /**
-     * Converts a int node to its value as a string.
+     * Converts a int node to its value as an int.
      *
      * @throws The function can throw interpreter and std exceptions.
      *         The parser will only catch the interpreter exceptions.
      *         Every other exceptions is not catched by the parser!
      */
-    Int ProcessIntNode(const ParserNode& node) const;
+    AttributeValue ProcessIntNode(const ParserNode& node) const;
 
     /**
-     * Converts a int node to its value as a string.
+     * Converts a float node to its value as a float.
      *
      * @throws The function can throw interpreter and std exceptions.
      *         The parser will only catch the interpreter exceptions.
      *         Every other exceptions is not catched by the parser!
      */
-    Float ProcessFloatNode(const ParserNode& node) const;
+    AttributeValue ProcessFloatNode(const ParserNode& node) const;
 
     /**
-     * Converts a bool node to its value as a string.
+     * Converts a bool node to its value as a bool.
      *
      * @throws The function can throw interpreter and std exceptions.
      *         The parser will only catch the interpreter exceptions.
      *         Every other exceptions is not catched by the parser!
      */
-    Bool ProcessBoolNode(const ParserNode& node) const;
+    AttributeValue ProcessBoolNode(const ParserNode& node) const;
 
     /**
-     * Converts a vector node to its value as a string that can be used
-     * on a vector attribute type.
-     * The structure of the return value is:
-     * value_a,value_b,value_c
-     * Keep in mind that the "()" wount be included in the return value.
-     * The child nodes of the vector are the values ​​that make up the vector.
+     * Converts a vector node to a Float2, Float3 or Float4 value,
+     * depending on the number of child values, and passes it to the
+     * function.
+     * The value only exists during the call of the function.
+     * The child values are converted directly to floats, see
+     * ProcessVectorValue.
      *
      * @param node - Vector node containing the child values.
      * @param parent_object - Object that is used to resolve attribute
      *                        access nodes.
+     * @param function - Function that is called with the final value.
      * @throws The function can throw interpreter and std exceptions.
      *         The parser will only catch the interpreter exceptions.
      *         Every other exceptions is not catched by the parser!
      */
-    std::shared_ptr<Attribute> ProcessVectorNode(
+    template<typename Function>
+    void ProcessVectorNode(const ParserNode& node, Object& parent_object,
+                           const Function& function) const;
+
+    /**
+     * Converts a vector node to a value, see the function above.
+     */
+    AttributeValue ProcessVectorNode(
         const ParserNode& node, Object& parent_object) const;
 
+    /**
+     * Converts a child value of a vector node to a float.
+     * Int, float and string values, as well as references to attributes
+     * of these types, are supported.
+     *
+     * @return false if the value can not be converted.
+     * @throws The function can throw interpreter and std exceptions.
+     *         The parser will only catch the interpreter exceptions.
+     *         Every other exceptions is not catched by the parser!
+     */
+    bool ProcessVectorValue(const ParserNode& node, Object& parent_object,
+                            float& dest) const;
+
+    /**
+     * Converts the child values of a vector node to a string, in the form
+     * value_a,value_b,value_c. Only used for error messages.
+     */
+    std::string VectorNodeToString(const ParserNode& node,
+                                   Object& parent_object) const;
+
     /**
      * Helper function that takes a node of one of the following types:
      * - StringNode
@@ -332,13 +456,13 @@ private:
      * - AttributeAccessNode
      *
      * The function will call the corresponding process function of the node
-     * type.
+     * type. Values of attribute access nodes are copied.
      *
      * @throws The function can throw interpreter and std exceptions.
      *         The parser will only catch the interpreter exceptions.
      *         Every other exceptions is not catched by the parser!
      */
-    std::shared_ptr<Attribute> ProcessValueNode(
+    AttributeValue ProcessValueNode(
         const ParserNode& node, Object& parent_object) const;
 
     /**
@@ -392,7 +516,7 @@ private:
      *         Every other exceptions is not catched by the parser!
      */
     Attribute& GetAttributeFromObject(
-        const std::string attribute,
+        const Atom attribute,
         Object& parent_object,
         const ParserNode& node) const;
 
@@ -407,26 +531,7 @@ private:
      *         Every other exceptions is not catched by the parser!
      */
     Attribute& GetAttribtueFromObjectReference(
-        const std::string attribute, const ParserNode& node) const;
-
-    /**
-     * Gets the full object ID of an attribtue reference string.
-     * Uses the object references.
-     * Example:
-     * object_0.child_0.child_1.attribute -> object_0.chidl_0.child_1
-     *
-     * The function will also check if the object exists in the
-     * object references. An exception is thrown if it does not exists.
-     *
-     * @param attribute - Full name of the attribute, containing full ID of
-     *                    the object. E.g. panel_0.text_0.position
-     * @param node - Used for error handling
-     * @throws The function can throw interpreter and std exceptions.
-     *         The parser will only catch the interpreter exceptions.
-     *         Every other exceptions is not catched by the parser!
-     */
-    std::string GetObjectNameFromAttributeReferenceString(
-        const std::string attribute, const ParserNode& node) const;
+        std::string_view attribute, const ParserNode& node) const;
 
     /**
      * Converts the type of an attribtue to one of the following strings:
@@ -1,15 +1,30 @@
 #ifndef IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_PARSER_LEXER_H_
 #define IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_PARSER_LEXER_H_
 
+#include "imgui_markup/common/atom.h"
+#include "imgui_markup/common/memory.h"
 #include "imgui_markup/parser/parser_result.h"
+#include "imgui_markup/parser/source_buffer.h"
+#include "imgui_markup/parser/source_location.h"
+#include "imgui_markup/parser/virtual_file_system.h"
 
-#include <fstream>
+#include <array>
+#include <cstdint>
+#include <functional>
 #include <string>
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 namespace imgui_markup::internal::parser
 {
 
-enum class LexerTokenType
+struct CachedFile;
+class IncludePrefetcher;
+
+enum class LexerTokenType : uint8_t
 {
     kUndefined,      // Undefined token that is returned when e.g. the
                      // LookAhead function gets called when there is no more
@@ -30,16 +45,37 @@ enum class LexerTokenType
     kEOF             // End of file
 };
 
+/**
+ * Tokens do not own their data. They only store the location of the
+ * characters inside the source file, which can be accessed through the
+ * lexer that generated the token.
+ */
 struct LexerToken
 {
-    LexerToken();
-    LexerToken(const LexerTokenType type, const ParserPosition position);
-    LexerToken(const LexerTokenType type, const ParserPosition position,
-               const std::string data);
-
-    LexerTokenType type;
-    ParserPosition position;
-    std::string data;
+    LexerToken() = default;
+    LexerToken(const LexerTokenType type, const SourceLocation location);
+
+    LexerTokenType type = LexerTokenType::kUndefined;
+    SourceLocation location;
+
+    /**
+     * Value of kInt and kFloat tokens, converted by the lexer so that the
+     * digits do not have to be parsed a second time.
+     */
+    union
+    {
+        int   int_value = 0;
+        float float_value;
+    };
+
+    /**
+     * Interned characters of kData tokens, so that the parser does not
+     * have to copy the names of objects and attributes.
+     * Data containing '.' is an attribute reference, which is not interned
+     * so that the atom table does not grow with every reference. The atom
+     * of these tokens is empty, see Lexer::GetTokenData.
+     */
+    Atom atom;
 };
 
 /* Exceptions */
@@ -134,6 +170,21 @@ struct InvalidNumber : public LexerException
     { }
 };
 
+/**
+ * Same error as the AttributeConversionError of the interpreter, which
+ * reported numbers that could not be converted before the lexer
+ * converted them.
+ */
+struct NumberConversionError : public LexerException
+{
+    NumberConversionError(std::string type, std::string value,
+                          LexerToken token)
+        : LexerException("Unable to convert \"" + value + "\" to a " +
+                         "value of type: \"" + type + "\"", token,
+                         ParserResultType::kAttributeConversionError)
+    { }
+};
+
 /**
  * Class to convert the contents of a file to tokens.
  * It is build to work together with the parser and not as a standalone class.
@@ -153,6 +204,37 @@ public:
      */
     void InitFile(const std::string path);
 
+    /**
+     * Resets the lexer and sets the mode to generate the tokens based
+     * from in-memory data. The data is not copied and has to stay valid
+     * until the lexer is reset.
+     * Paths of include instructions inside the data are relative to the
+     * current working directory.
+     *
+     * @param data - Data from where the tokens will be loaded.
+     * @throws The function can throw lexer and std exceptions.
+     *         The parser will only catch the lexer exceptions.
+     *         Every other exceptions is not catched by the parser!
+     */
+    void InitData(std::string_view data);
+
+    /**
+     * Resets the lexer and sets the mode to generate the tokens based
+     * from a file inside a virtual filesystem. Every include instruction
+     * is resolved through the virtual filesystem, the real filesystem
+     * is never accessed.
+     * The virtual filesystem has to stay valid until the lexer is reset.
+     *
+     * @param path  - Path of the file inside the virtual filesystem.
+     * @param files - Virtual filesystem containing the file and every
+     *                file that is included.
+     * @throws The function can throw lexer and std exceptions.
+     *         The parser will only catch the lexer exceptions.
+     *         Every other exceptions is not catched by the parser!
+     */
+    void InitVirtualFile(const std::string path,
+                         const VirtualFileSystem& files);
+
     /**
      * Gets the next token in the data and increments
      * the current position by one. Keep in mind that the next token is
@@ -179,26 +261,82 @@ public:
      * @param offset - Offset from the current position.
      *                 Offset = 0 is the current token, while offset = 1 is
      *                 the next token.
+     *                 The offset can not be greater than
+     *                 kLookAheadCapacity.
      * @return The token at the current position plus the given offset.
      *         The token type will be set to kUndefined if the offset is
-     *         out of range.
+     *         out of range. The reference stays valid until the next call
+     *         to GetNextToken.
      * @throws The function can throw lexer and std exceptions.
      *         The parser will only catch the lexer exceptions.
      *         Every other exceptions is not catched by the parser!
      */
-    LexerToken LookAhead(const size_t offset = 1);
+    const LexerToken& LookAhead(const size_t offset = 1);
+
+    /**
+     * Maximum number of tokens that can be loaded by the LookAhead function.
+     * Has to be a power of two.
+     */
+    static constexpr size_t kLookAheadCapacity = 4;
 
     /**
      * Resets the entire lexer and delete the data.
      */
     void Reset();
 
-    static std::string TokenToString(LexerToken token);
+    /**
+     * Gets the characters of a token inside the source file.
+     * The quotes of string tokens are not included, escape sequences
+     * are not resolved. Use GetTokenString for the final string value.
+     * The view stays valid until the lexer is reset.
+     */
+    std::string_view GetTokenData(const LexerToken& token) const;
+
+    /**
+     * Gets the data of a token as a string. Escape sequences of string tokens
+     * are resolved.
+     */
+    std::string GetTokenString(const LexerToken& token) const;
+
+    /**
+     * Converts a source location of a token, that was generated by this
+     * lexer, to a full parser position containing the file stack, the line
+     * and the line number.
+     * This should only be used for error reporting, because the line offsets
+     * of the file have to be loaded on the first call.
+     */
+    ParserPosition GetPosition(const SourceLocation& location);
+
+    std::string TokenToString(const LexerToken& token) const;
+
+    /**
+     * Calls the function with the path and the content of every file that
+     * was loaded since the last reset, starting with the main file.
+     * Files that were included multiple times are only passed once.
+     */
+    void ForEachSourceFile(const std::function<
+        void(std::string_view path, std::string_view data)>& function) const;
+
+    /**
+     * Resolves the escape sequences of the data of a string token.
+     */
+    static std::string UnescapeString(std::string_view data);
 
 private:
-    struct File
+    friend class IncludePrefetcher;
+
+    template<typename T>
+    using Vector = std::vector<T, MemoryAllocator<T, MemorySubsystem::kLexer>>;
+
+    /**
+     * Every file that was opened since the last reset.
+     * The index inside the vector is the file ID that is used by the tokens.
+     * Files are kept open until the lexer is reset, so that the data of
+     * the tokens stays valid.
+     */
+    struct Source
     {
-        explicit File(std::string path);
+        Source(std::string path, uint16_t parent_id);
 
         /**
          * Path to the file
@@ -206,38 +344,116 @@ private:
         std::string path;
 
         /**
-         * Main file handle
+         * Entire content of the file.
          */
-        std::ifstream file;
+        SourceBuffer buffer;
 
         /**
-         * Current virtual cursor position in the current line that is
-         * being porcessed.
+         * Set if the file is not located on the filesystem, but loaded
+         * from in-memory data or a virtual filesystem.
          */
-        size_t position_in_line = 0;
+        bool in_memory = false;
 
         /**
-         * Current line of the file that is processed.
+         * Identity of the file on disk. Only set if the file is not
+         * in memory.
          */
-        std::string current_line;
+        FileIdentity identity;
 
         /**
-         * Number of the current line.
+         * Cached token stream of the file, only set for included files.
+         * The buffer of the source is a view of the cached buffer.
          */
-        size_t line_number = 0;
+        std::shared_ptr<const CachedFile> cached_file;
+
+        /**
+         * ID of the file that included this file.
+         * kInvalidFileID if this is the main file.
+         */
+        uint16_t parent_id;
+
+        /**
+         * Offset of the beginning of every line. Only loaded when a
+         * position inside the file is requested.
+         */
+        Vector<uint32_t> line_offsets;
     };
-    std::vector<File> file_stack_;
+    Vector<Source> sources_;
 
     /**
-     * Buffer that stores tokens that were loaded by the LookAhead function.
+     * Files that are currently processed. The last file on the stack
+     * is the file from where the tokens are generated.
+     */
+    struct File
+    {
+        /**
+         * ID of the file inside the sources_.
+         */
+        uint16_t id;
+
+        /**
+         * Start of the file, position of the next char that will be
+         * processed and end of the file.
+         */
+        const char* begin;
+        const char* cursor;
+        const char* end;
+
+        /**
+         * Cached token stream that is replayed instead of scanning the
+         * file. nullptr if the file is scanned.
+         * Index of the next token and next include instruction
+         * inside the cached file.
+         */
+        const CachedFile* cached_file = nullptr;
+        size_t next_token   = 0;
+        size_t next_include = 0;
+    };
+    Vector<File> file_stack_;
+
+    /**
+     * Included files that were already resolved since the last reset.
+     * Used so that files that are included multiple times are only
+     * looked up once in the include cache.
+     */
+    std::unordered_map<
+        std::string, std::shared_ptr<const CachedFile>,
+        std::hash<std::string>, std::equal_to<std::string>,
+        MemoryAllocator<std::pair<const std::string,
+                                  std::shared_ptr<const CachedFile>>,
+                        MemorySubsystem::kLexer>> include_files_;
+
+    /**
+     * Loads the files that are included by the main file in the
+     * background. nullptr if the main file includes only a few files,
+     * see IncludePrefetcher::kMinIncludeCount.
+     */
+    std::shared_ptr<IncludePrefetcher> prefetcher_;
+
+    /**
+     * Virtual filesystem used to load the files.
+     * nullptr if the files are loaded from the real filesystem.
+     */
+    const VirtualFileSystem* virtual_files_ = nullptr;
+
+    /**
+     * Circular buffer that stores tokens that were loaded by the
+     * LookAhead function.
      * The tokens in the buffer are used and removed by the GetNextToken
      * function if tokens exists. This should prevent the loss and mulitple
      * loading of tokens generated by the LookoAhead function.
      */
-    std::vector<LexerToken> token_buffer_;
+    std::array<LexerToken, kLookAheadCapacity> token_buffer_;
+    size_t token_buffer_start_ = 0;
+    size_t token_buffer_size_  = 0;
 
     LexerToken last_token_;
 
+    /**
+     * Returned by the LookAhead function if the offset is out of range.
+     */
+    const LexerToken undefined_token_;
+
     /**
      * Opens a file and adds it to the file_stack.
      * Directly calls the OpenIncludeFile function and
@@ -254,23 +470,49 @@ private:
      * Opens a file and adds it to the file_stack.
      *
      * @param path - Path to the file that will be added.
-     *               only relative paths are allowed.
      * @param include_token - Token of the include instruction,
      *                        used for error handling.
      * @throws The function can throw lexer and std exceptions.
      *         The parser will only catch the lexer exceptions.
      *         Every other exceptions is not catched by the parser!
      */
-    void OpenIncludeFile(LexerToken include_token);
+    void OpenIncludeFile(std::string path, LexerToken include_token);
+
+    /**
+     * Loads the content of a file from the filesystem or the
+     * virtual filesystem into a source. Used by the OpenIncludeFile function.
+     * LoadIncludedFile loads the file through the include cache.
+     *
+     * @throws FileNotFound if the file does not exist.
+     * @throws UnableToOpenFile if the file can not be loaded.
+     */
+    void LoadFile(Source& source, LexerToken include_token) const;
+    void LoadVirtualFile(Source& source, LexerToken include_token) const;
+    void LoadIncludedFile(Source& source, LexerToken include_token);
 
     /**
-     * Closes every file handle on the file stack.
+     * Loads a file from the filesystem and generates its tokens,
+     * without processing the include instructions inside the file.
+     * Errors while generating the tokens are stored inside the cached file.
+     *
+     * @throws UnableToOpenFile if the file can not be loaded.
      */
-    void CloseFiles();
+    std::shared_ptr<const CachedFile> CacheFile(
+        const std::string& path, const FileIdentity& identity,
+        LexerToken include_token);
 
     /**
-     * Removes and closes the file handle of current file
-     * that is on top of the file stack.
+     * Adds a source to the sources and pushes it onto the file stack.
+     *
+     * @throws UnableToOpenFile if the maximum number of files is reached
+     *         or the file is too large.
+     * @throws FileIncludesItself if the file is already on the file stack.
+     */
+    void PushSource(Source source, LexerToken include_token);
+
+    /**
+     * Removes the current file that is on top of the file stack.
+     * The data of the file stays loaded until the lexer is reset.
      */
     void RemoveCurrentFile();
 
@@ -286,34 +528,25 @@ private:
      */
     bool GetNextChar(char& dest);
 
-    /**
-     * Gets the current character that is being processed, without
-     * incrementing the current position.
-     *
-     * @param offset - Offset of the character in the line.
-     *                 An offset of 0 is the current char. If the offset is
-     *                 out of range of the current line, a char with the
-     *                 value 0 will be returned.
-     */
-    char GetCurrentChar(size_t offset = 0) const;
-
     /**
      * Generates the next token and increments the current buffer position.
      * The function also opens new files (@include <file_path>) and also
      * closes files that are finished processing.
+     * Tokens of included files are replayed from the include cache.
      */
     LexerToken GenerateToken();
 
     /**
-     * Checks if the char at the current position is the start of a comment.
-     */
-    bool IsComment() const;
-
-    /**
-     * Assumes that the current char is the start of a comment.
-     * The function will skip the chars until the comment end.
+     * Scans the next token of the current file. Whitespaces and comments
+     * are skipped by the scanner functions (see lexer_scanner.h), which
+     * process multiple chars at once.
+     *
+     * @param include - Set to true if the token is the argument of an
+     *                  include instruction. The file is not opened.
+     * @return The scanned token, or a kEOF token at the end of the file.
+     *         The file is not removed from the file stack.
      */
-    void SkipComment();
+    LexerToken ScanToken(bool& include);
 
     /**
      * Assumes that the current char is the start of a string.
@@ -329,7 +562,11 @@ private:
      * Assumes that the current char is the start of a number.
      * Int and float numbers are supported.
      *
-     * @return Created token with the number as a string
+     * @return Created token with the converted number.
+     * @throws NumberConversionError if the characters can not be converted,
+     *         e.g. "-" or a number that is out of range.
+     * @throws InvalidNumber if only the beginning of the characters is a
+     *         number, e.g. "1.2.3".
      */
     LexerToken CreateNumber();
 
@@ -338,21 +575,20 @@ private:
      * true and false are the only valid bool values and have to be written
      * in lowercase.
      *
-     * @param temnp_buffer - Buffer that will recive the bool value.
-     *                       This is used so that the bool value
-     *                       does not have to get generated multiple times
-     *                       between the check and the creation function..
+     * @param length - Receives the number of characters of the bool value.
+     *                 This is used so that the bool value does not have to
+     *                 be checked again by the creation function.
      */
-    bool IsBool(std::string& temp_buffer) const;
+    bool IsBool(size_t& length) const;
 
     /**
      * Assumes that the current char is the start of a bool value and creates
      * a bool token.
      * See IsBool() for more information.
-     * 
-     * @param value - true/false value generated by the IsBool function.
+     *
+     * @param length - Length of the value generated by the IsBool function.
      */
-    LexerToken CreateBool(std::string value);
+    LexerToken CreateBool(size_t length);
 
     /**
      * Assumes that the current char is the start of some data.
@@ -377,7 +613,7 @@ private:
      * The following lexer instructions are implemented:
      *   - <@>include "<file>"
      *
-     * @return LexerToken after the instruction is executed.
+     * @return The argument of the include instruction.
      * @throws The function can throw lexer and std exceptions.
      *         The parser will only catch the lexer exceptions.
      *         Every other exceptions is not catched by the parser!
@@ -387,35 +623,50 @@ private:
     /**
      * Assumes that the current char is the start of the first argument
      * of the include instruction.
-     * The include instruction will open a new file and add it to the
-     * file stack. It takes one argument of type string, which is the path
-     * to the file that will be opened. The path has to be relative to the
-     * file from where the instruction is executed.
+     * The include instruction takes one argument of type string, which is
+     * the path to the file that will be opened. The path has to be relative
+     * to the file from where the instruction is executed.
      *
-     * @return The first token of the new file.
+     * @return The argument of the include instruction.
      * @throws The function can throw lexer and std exceptions.
      *         The parser will only catch the lexer exceptions.
      *         Every other exceptions is not catched by the parser!
      */
     LexerToken ProcessIncludeInstruction();
 
+    /**
+     * Opens the file of an include instruction and adds it to the
+     * file stack.
+     *
+     * @param argument - Argument of the include instruction, located in
+     *                   the current file.
+     * @throws The function can throw lexer and std exceptions.
+     *         The parser will only catch the lexer exceptions.
+     *         Every other exceptions is not catched by the parser!
+     */
+    void IncludeFile(const LexerToken& argument);
+
     /**
      * Used to construct LexerTokens with a different amount of arguments.
-     * The functions will also set the file stack and the current line
-     * of the token.
+     * Without a start and end, the token will be located at the current char.
+     * The start and end are offsets inside the current file, the end offset
+     * is the last char of the token.
      */
     LexerToken ConstructToken(LexerTokenType type) const;
-    LexerToken ConstructToken(LexerTokenType type, std::string data) const;
-    LexerToken ConstructToken(LexerTokenType type, std::string data,
+    LexerToken ConstructToken(LexerTokenType type,
                               size_t start, size_t end) const;
-    std::vector<std::string> ConvertFileStack() const;
 
     /**
-     * Returns the current line position.
+     * Returns the offset of the current char inside the current file.
      * 0 will be returned if there is no file on the file stack.
      */
     size_t GetCurrentPosition() const;
 
+    /**
+     * Loads the line offsets of a source, if they are not already loaded.
+     */
+    void LoadLineOffsets(Source& source) const;
+
     /**
      * Returns the path of the current directory from where the current file
      * is processed.
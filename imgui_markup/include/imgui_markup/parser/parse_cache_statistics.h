@@ -0,0 +1,38 @@
+#ifndef IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_PARSER_PARSE_CACHE_STATISTICS_H_
+#define IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_PARSER_PARSE_CACHE_STATISTICS_H_
+
+#include <cstdint>
+
+namespace imgui_markup
+{
+
+/**
+ * Counters of the parse cache since the process was started,
+ * see EnableParseCache.
+ */
+struct ParseCacheStatistics
+{
+    /**
+     * Parsed files that were loaded from the cache.
+     */
+    uint64_t hits = 0;
+
+    /**
+     * Parsed files that were not cached or whose files were changed.
+     */
+    uint64_t misses = 0;
+
+    /**
+     * Object trees that were written to the cache.
+     */
+    uint64_t writes = 0;
+
+    /**
+     * Cache entries that were removed to stay below the maximum size.
+     */
+    uint64_t evictions = 0;
+};
+
+}  // namespace imgui_markup
+
+#endif  // IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_PARSER_PARSE_CACHE_STATISTICS_H_
@@ -6,8 +6,13 @@
 #include "imgui_markup/parser/lexer.h"
 #include "imgui_markup/parser/interpreter.h"
 #include "imgui_markup/parser/parser_nodes.h"
+#include "imgui_markup/parser/parser_node_arena.h"
+#include "imgui_markup/parser/parser_mode.h"
 
+#include <functional>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace imgui_markup::internal::parser
@@ -158,10 +163,18 @@ struct MissingVectorValue : public ParserException
 class Parser
 {
 public:
+    /**
+     * @param mode - Defines how the parsed data is passed to the
+     *               interpreter, see ParserMode.
+     */
+    explicit Parser(ParserMode mode = ParserMode::kNodeTree);
+
     /**
      * Parses the data from a file, containing the layer's markup language.
      * If the file does not exist or the parser is unable to open the file,
      * the parser will stop the process and return with an parser error result.
+     * If the parse cache is enabled, the object tree is loaded from the
+     * cache when none of the files changed, see ParseCache.
      *
      * @param file - Path to the file from where the data will be loaded.
      *               Absolute and relative paths are allowed.
@@ -179,23 +192,41 @@ public:
     ParserResult ParseFile(const std::string file, GlobalObject& dest);
 
     /**
-     * Parses raw string, containing the layer's markup language.
+     * Parses in-memory data, containing the layer's markup language.
+     * The data is not copied. Paths of include instructions inside the data
+     * are relative to the current working directory.
      *
-     * @param data - String containg the layer's markup language.
+     * @param data - Data containg the layer's markup language.
      * @param dest - Reference to a GlobalObject receiving the generated
      *               object tree.
-     * @return Result of the operation as a ParserResult, containing error type,
-     *         message and line positions. If there was no error,
-     *         the ParesrResultType will be set to ParserErrorType::kSuccess and
-     *         the line positions are 0. Everything else is an error that
-     *         occured while loading the file. This can contain an error from
-     *         the Lexer, Parser and Interpreter. The parser will stop the
-     *         process and the global_object will be empty when an error occured
-     *         while parsing the file.
+     * @return Result of the operation as a ParserResult, see ParseFile.
+     */
+    ParserResult ParseData(std::string_view data, GlobalObject& dest);
+
+    /**
+     * Parses a file from a virtual filesystem, containing the layer's
+     * markup language. Include instructions are resolved through the
+     * virtual filesystem, the real filesystem is never accessed.
+     * The content of the files is not copied.
+     *
+     * @param file  - Path of the file inside the virtual filesystem.
+     * @param files - Virtual filesystem containing the file and every file
+     *                that is included.
+     * @param dest  - Reference to a GlobalObject receiving the generated
+     *                object tree.
+     * @return Result of the operation as a ParserResult, see ParseFile.
      */
-    // NOTE: This function will be implemented later.
-    //       Currently the focus is to be able to parse the data from a file.
-    // ParserResult ParseData(const std::string data, GlobalObject& dest);
+    ParserResult ParseBuffers(const std::string file,
+                              const VirtualFileSystem& files,
+                              GlobalObject& dest);
+
+    /**
+     * Frees the memory that is kept between two calls of the parse
+     * functions, e.g. the blocks of the node arena.
+     */
+    void ReleaseMemory();
+
+    inline ParserMode GetMode() const { return this->mode_; }
 
 private:
     /**
@@ -208,11 +239,39 @@ private:
      */
     Interpreter interpreter_;
 
+    /**
+     * Owns every node of the current node tree. The arena is reset after
+     * the node tree was converted to the object tree.
+     */
+    ParserNodeArena node_arena_;
+
+    const ParserMode mode_;
+
+    /**
+     * First error of the interpreter in streaming mode. The parser
+     * continues to parse the data after the error, without interpreting it,
+     * so that lexer and parser errors are preferred like in the node tree
+     * mode, where the entire data is parsed before it is interpreted.
+     */
+    std::optional<InterpreterException> interpreter_error_;
+
     /**
      * Resets the entire parser.
      */
     void Reset();
 
+    /**
+     * Initializes the lexer using the given function and converts
+     * the generated tokens to the final object tree.
+     * Used by every Parse function.
+     *
+     * @param init_lexer - Function that sets the source of the lexer.
+     * @param dest       - Reference to a GlobalObject receiving the
+     *                     generated object tree.
+     */
+    ParserResult Parse(const std::function<void()>& init_lexer,
+                       GlobalObject& dest);
+
     /**
      * Processes the next token and generates new nodes based on the tokens.
      *
@@ -222,7 +281,17 @@ private:
      *         The parser will only catch the parser exceptions.
      *         Every other exceptions is not catched by the parser!
      */
-    void ProcessTokens(std::shared_ptr<ParserNode> parent_node);
+    void ProcessTokens(ParserNode& parent_node);
+
+    /**
+     * Passes a node to the interpreter in streaming mode, unless the
+     * interpreter already reported an error.
+     * Interpreter exceptions are stored inside interpreter_error_.
+     *
+     * @param event - Function calling the interpreter.
+     */
+    template<typename Event>
+    void Interpret(const Event& event);
 
     /**
      * Checks if the current token is the end of a block.
@@ -258,7 +327,7 @@ private:
      *   - String
      */
     bool TokenIsStringNode();
-    std::shared_ptr<ParserStringNode> CreateStringNode();
+    ParserStringNode* CreateStringNode();
 
     /**
      * Checks if the current token is the start of a int node.
@@ -267,7 +336,7 @@ private:
      *   - Int
      */
     bool TokenIsIntNode();
-    std::shared_ptr<ParserIntNode> CreateIntNode();
+    ParserIntNode* CreateIntNode();
 
     /**
      * Checks if the current token is the start of a float node.
@@ -276,7 +345,7 @@ private:
      *   - Float
      */
     bool TokenIsFloatNode();
-    std::shared_ptr<ParserFloatNode> CreateFloatNode();
+    ParserFloatNode* CreateFloatNode();
 
     /**
      * Checks if the current token is the start of a bool node.
@@ -285,7 +354,7 @@ private:
      *   - Bool
      */
     bool TokenIsBoolNode();
-    std::shared_ptr<ParserBoolNode> CreateBoolNode();
+    ParserBoolNode* CreateBoolNode();
 
     /**
      * Checks if the current token is the start of a vector node.
@@ -294,7 +363,7 @@ private:
      *   - BracketOpen
      */
     bool TokenIsVectorNode();
-    std::shared_ptr<ParserVectorNode> CreateVectorNode();
+    ParserVectorNode* CreateVectorNode();
 
     /**
      * Checks if the current token is the start of an attribute access node.
@@ -303,7 +372,14 @@ private:
      *   - Data
      */
     bool TokenIsAttributeAccessNode();
-    std::shared_ptr<ParserAttributeAccessNode> CreateAttributeAccessNode();
+    ParserAttributeAccessNode* CreateAttributeAccessNode();
+
+    /**
+     * Gets the atom of a data token that names an object type, object ID
+     * or attribute. The lexer does not intern data containing '.', see
+     * LexerToken::atom, so these names are interned here.
+     */
+    Atom GetTokenAtom(const LexerToken& token) const;
 };
 
 }  // namespace imgui_markup::internal::parser
@@ -0,0 +1,29 @@
+#ifndef IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_PARSER_PARSER_MODE_H_
+#define IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_PARSER_PARSER_MODE_H_
+
+namespace imgui_markup
+{
+
+/**
+ * Defines how the parser passes the parsed data to the interpreter.
+ * Both modes generate the same object tree and report the same errors.
+ */
+enum class ParserMode
+{
+    /**
+     * The entire node tree is generated before it is converted to the
+     * object tree. Memory usage grows with the size of the file.
+     */
+    kNodeTree,
+
+    /**
+     * Objects and attributes are interpreted as soon as they are parsed.
+     * Only the objects that are currently open are kept in memory, so the
+     * memory usage grows with the nesting depth instead of the file size.
+     */
+    kStreaming
+};
+
+}  // namespace imgui_markup
+
+#endif  // IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_PARSER_PARSER_MODE_H_
@@ -0,0 +1,107 @@
+#ifndef IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_PARSER_PARSER_NODE_ARENA_H_
+#define IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_PARSER_PARSER_NODE_ARENA_H_
+
+#include "imgui_markup/common/memory.h"
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace imgui_markup::internal::parser
+{
+
+/**
+ * Bump allocator that owns every node of a node tree. The blocks are
+ * allocated through the allocator functions of the layer.
+ * The nodes are only needed until the interpreter converted the node tree,
+ * so they are never freed separately. Instead, the entire arena is reset
+ * in one step after the tree was processed.
+ */
+class ParserNodeArena
+{
+public:
+    ParserNodeArena() = default;
+    ~ParserNodeArena();
+
+    ParserNodeArena(const ParserNodeArena&) = delete;
+    ParserNodeArena& operator=(const ParserNodeArena&) = delete;
+
+    /**
+     * Constructs a new object inside the arena.
+     * The object is destroyed when the arena is reset.
+     *
+     * @return Pointer to the object, which stays valid until the arena
+     *         is reset.
+     * @throws std::bad_alloc if there is not enough memory.
+     */
+    template<typename T, typename... Args>
+    T* Create(Args&&... args)
+    {
+        void* memory = this->Allocate(sizeof(T), alignof(T));
+        T* object = new (memory) T(std::forward<Args>(args)...);
+
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            this->destructors_.push_back(
+                { object, [](void* o) { static_cast<T*>(o)->~T(); } });
+        }
+
+        return object;
+    }
+
+    /**
+     * Destroys every object inside the arena. The blocks are kept and
+     * reused by the next node tree, so that a parser that is used
+     * multiple times only allocates memory for the largest node tree.
+     * Blocks of objects larger than the block size are freed.
+     */
+    void Reset();
+
+    /**
+     * Destroys every object and frees every block.
+     */
+    void Release();
+
+private:
+    static constexpr size_t kBlockSize = 64 * 1024;
+
+    struct Destructor
+    {
+        void* object;
+        void (*destroy)(void*);
+    };
+
+    using Block = MemoryBlock<char, MemorySubsystem::kParser>;
+
+    template<typename T>
+    using Allocator = MemoryAllocator<T, MemorySubsystem::kParser>;
+
+    /**
+     * Blocks of the default size, which are reused after a reset.
+     * current_block_ is the block containing the cursor.
+     */
+    std::vector<Block, Allocator<Block>> blocks_;
+    size_t current_block_ = 0;
+    char* cursor_ = nullptr;
+    char* end_    = nullptr;
+
+    /**
+     * Blocks of objects larger than the block size, freed on every reset.
+     */
+    std::vector<Block, Allocator<Block>> large_blocks_;
+
+    /**
+     * Objects that are not trivially destructible, e.g. nodes containing
+     * a std::string. They are destroyed in reverse order.
+     */
+    std::vector<Destructor, Allocator<Destructor>> destructors_;
+
+    void* Allocate(size_t size, size_t alignment);
+};
+
+}  // namespace imgui_markup::internal::parser
+
+#endif  // IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_PARSER_PARSER_NODE_ARENA_H_
@@ -1,15 +1,15 @@
 #ifndef IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_PARSER_PARSER_NODES_H_
 #define IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_PARSER_PARSER_NODES_H_
 
-#include "imgui_markup/parser/parser_result.h"
+#include "imgui_markup/common/atom.h"
+#include "imgui_markup/parser/source_location.h"
 #include "imgui_markup/attribute_types/bool.h"
 #include "imgui_markup/attribute_types/float.h"
 #include "imgui_markup/attribute_types/int.h"
 #include "imgui_markup/attribute_types/string.h"
 
 #include <string>
-#include <vector>
-#include <memory>
+#include <string_view>
 
 namespace imgui_markup::internal::parser
 {
@@ -27,75 +27,99 @@ enum class ParserNodeType
     kAttributeAccessNode
 };
 
+/**
+ * Nodes are owned by the ParserNodeArena of the parser that created them.
+ * They are only valid until the node tree was converted by the interpreter.
+ */
 struct ParserNode
 {
-    ParserNode(ParserNodeType type, ParserPosition position);
+    ParserNode(ParserNodeType type, SourceLocation location);
 
     const ParserNodeType type;
-    ParserPosition position;
-    std::vector<std::shared_ptr<ParserNode>> child_nodes;
+    SourceLocation location;
+
+    /**
+     * The child nodes are stored as a linked list, in the order in which
+     * they were added.
+     */
+    ParserNode* first_child  = nullptr;
+    ParserNode* last_child   = nullptr;
+    ParserNode* next_sibling = nullptr;
+
+    void AddChild(ParserNode* child);
 };
 
 struct ParserObjectNode : public ParserNode
 {
-    ParserObjectNode(std::string object_type, std::string object_id,
-                     ParserPosition position);
+    ParserObjectNode(Atom object_type, Atom object_id,
+                     SourceLocation location);
 
-    const std::string object_type;
-    const std::string object_id;
+    const Atom object_type;
+    const Atom object_id;
 };
 
 struct ParserStringNode : public ParserNode
 {
-    ParserStringNode(std::string value, ParserPosition position);
+    ParserStringNode(std::string value, SourceLocation location);
 
     const String value;
 };
 
 struct ParserIntNode : public ParserNode
 {
-    ParserIntNode(std::string value, ParserPosition position);
+    ParserIntNode(int value, SourceLocation location);
 
-    const std::string value;
+    const int value;
 };
 
 struct ParserFloatNode : public ParserNode
 {
-    ParserFloatNode(std::string value, ParserPosition position);
+    ParserFloatNode(float value, SourceLocation location);
 
-    const std::string value;
+    const float value;
 };
 
 struct ParserBoolNode : public ParserNode
 {
-    ParserBoolNode(std::string value, ParserPosition position);
+    ParserBoolNode(std::string value, SourceLocation location);
 
     const std::string value;
 };
 
 struct ParserVectorNode : public ParserNode
 {
-    ParserVectorNode(ParserPosition position);
+    ParserVectorNode(SourceLocation location);
 
     // NOTE: Values of the vector are stored in the child nodes.
 };
 
 struct ParserAttributeAssignNode : public ParserNode
 {
-    ParserAttributeAssignNode(std::string attribute_name,
-                              std::shared_ptr<ParserNode> value_node,
-                              ParserPosition position);
+    ParserAttributeAssignNode(Atom attribute_name,
+                              ParserNode* value_node,
+                              SourceLocation location);
 
-    const std::string attribute_name;
-    const std::shared_ptr<ParserNode> value_node;
+    const Atom attribute_name;
+    ParserNode* const value_node;
 };
 
 struct ParserAttributeAccessNode : public ParserNode
 {
-    ParserAttributeAccessNode(std::string attribute_name,
-                              ParserPosition position);
-
-    const std::string attribute_name;
+    ParserAttributeAccessNode(Atom attribute_name,
+                              std::string_view reference,
+                              SourceLocation location);
+
+    /**
+     * Name of an attribute of the current object. Empty if the node
+     * references an attribute of another object.
+     */
+    const Atom attribute_name;
+
+    /**
+     * Characters of the reference, e.g. panel_0.text_0.position.
+     * Points into the source data of the lexer, which outlives the node.
+     */
+    const std::string_view reference;
 };
 
 }  // namespace imgui_markup::internal::parser
@@ -70,7 +70,15 @@ enum class ParserResultType
     kObjectIsNotDefined,
     kNoAttributeSpecified,
     kObjectIsNotValid,
-    kInternalWrongNodeType
+    kInternalWrongNodeType,
+
+    // Compiled file errors:
+    kUnableToWriteFile,
+    kInvalidCompiledFile,
+    kCompiledFileOutdated,
+
+    // General errors:
+    kTooManyNames  // The atom table is full, see AtomTableFull
 };
 
 class ParserResult
@@ -0,0 +1,149 @@
+#ifndef IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_PARSER_PARSER_SESSION_H_
+#define IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_PARSER_PARSER_SESSION_H_
+
+#include "imgui_markup/parser/parser.h"
+#include "imgui_markup/parser/parser_mode.h"
+#include "imgui_markup/parser/parser_result.h"
+#include "imgui_markup/parser/virtual_file_system.h"
+#include "imgui_markup/objects/global_object.h"
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+namespace imgui_markup
+{
+
+/**
+ * Parser that can be used for multiple files, e.g. to reload files in
+ * a loop. Unlike the ParseFile function, the session keeps the memory
+ * of the lexer, the node arena and the interpreter between two calls,
+ * so that parsing a file again does not allocate the buffers again.
+ * Atoms and included files are cached process wide and stay loaded as
+ * well, see ClearIncludeCache.
+ *
+ * A session can only be used by one thread at a time. Use a
+ * ParserSessionPool to parse files from multiple threads.
+ */
+class ParserSession
+{
+public:
+    /**
+     * @param mode - Mode of every parse call, see ParserMode.
+     */
+    explicit ParserSession(ParserMode mode = ParserMode::kNodeTree);
+
+    ParserSession(const ParserSession&) = delete;
+    ParserSession& operator=(const ParserSession&) = delete;
+
+    /**
+     * Same as the ParseFile function, but reusing the memory of the
+     * previous calls.
+     */
+    ParserResult ParseFile(const char* path, GlobalObject& global_object);
+
+    /**
+     * Same as the ParseData function, but reusing the memory of the
+     * previous calls.
+     */
+    ParserResult ParseData(std::string_view data,
+                           GlobalObject& global_object);
+
+    /**
+     * Same as the ParseBuffers function, but reusing the memory of the
+     * previous calls.
+     */
+    ParserResult ParseBuffers(const char* path,
+                              const VirtualFileSystem& files,
+                              GlobalObject& global_object);
+
+    /**
+     * Frees the memory that is kept for the next call.
+     */
+    void ReleaseMemory();
+
+    inline ParserMode GetMode() const { return this->parser_.GetMode(); }
+
+private:
+    internal::parser::Parser parser_;
+};
+
+/**
+ * Thread safe pool of parser sessions using the same mode.
+ * Every thread acquires its own session, which is returned to the pool
+ * when the lease is destroyed. The number of sessions that are created
+ * is the maximum number of threads that used the pool at the same time.
+ */
+class ParserSessionPool
+{
+public:
+    /**
+     * Session that is borrowed from the pool. The session is returned to
+     * the pool when the lease is destroyed, so the pool has to outlive
+     * every lease.
+     */
+    class Lease
+    {
+    public:
+        Lease(Lease&& other) noexcept;
+        Lease& operator=(Lease&& other) noexcept;
+        ~Lease();
+
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+
+        inline ParserSession& operator*() const { return *this->session_; }
+        inline ParserSession* operator->() const
+            { return this->session_.get(); }
+
+    private:
+        friend class ParserSessionPool;
+
+        Lease(ParserSessionPool& pool,
+              std::unique_ptr<ParserSession> session);
+
+        ParserSessionPool* pool_;
+        std::unique_ptr<ParserSession> session_;
+    };
+
+    /**
+     * @param mode - Mode of every session, see ParserMode.
+     * @param max_idle_sessions - Maximum number of sessions that are kept
+     *                            while they are not used. Sessions that
+     *                            are returned to a full pool are destroyed.
+     */
+    explicit ParserSessionPool(ParserMode mode = ParserMode::kNodeTree,
+                               size_t max_idle_sessions = 16);
+
+    ParserSessionPool(const ParserSessionPool&) = delete;
+    ParserSessionPool& operator=(const ParserSessionPool&) = delete;
+
+    /**
+     * Takes an idle session from the pool, or creates a new session if
+     * every session is used.
+     */
+    Lease Acquire();
+
+    /**
+     * Destroys every idle session. Sessions that are currently used are
+     * not affected.
+     */
+    void Clear();
+
+    inline ParserMode GetMode() const { return this->mode_; }
+
+private:
+    const ParserMode mode_;
+    const size_t max_idle_sessions_;
+
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<ParserSession>> idle_sessions_;
+
+    void Release(std::unique_ptr<ParserSession> session);
+};
+
+}  // namespace imgui_markup
+
+#endif  // IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_PARSER_PARSER_SESSION_H_
@@ -0,0 +1,124 @@
+#ifndef IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_PARSER_SOURCE_BUFFER_H_
+#define IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_PARSER_SOURCE_BUFFER_H_
+
+#include "imgui_markup/common/memory.h"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <memory>
+
+namespace imgui_markup::internal::parser
+{
+
+/**
+ * Identifies a file on disk independent of the path that is used to
+ * access it. Device and inode identify the file, the modification time
+ * and size are used to detect changes of the file.
+ */
+struct FileIdentity
+{
+    uint64_t device = 0;
+    uint64_t inode  = 0;
+    int64_t  mtime  = 0;
+    uint64_t size   = 0;
+
+    /**
+     * Checks if both identities belong to the same file,
+     * ignoring the modification time and size.
+     */
+    inline bool SameFile(const FileIdentity& other) const
+    {
+        return this->device == other.device && this->inode == other.inode;
+    }
+
+    inline bool operator==(const FileIdentity& other) const
+    {
+        return this->SameFile(other) &&
+               this->mtime == other.mtime && this->size == other.size;
+    }
+};
+
+/**
+ * Gets the identity of a file.
+ *
+ * @return false if the file does not exist or is not a regular file.
+ */
+bool GetFileIdentity(const std::string& path, FileIdentity& dest);
+
+/**
+ * Read only buffer containing the entire content of a source file.
+ * On linux the file is memory mapped, on every other platform the file
+ * is read in one shot. The buffer can also be a view of data that is
+ * owned by somebody else, e.g. a string that is embedded in the binary.
+ * The address of the data stays the same when the buffer is moved,
+ * so raw cursors into the buffer stay valid.
+ */
+class SourceBuffer
+{
+public:
+    SourceBuffer() = default;
+    ~SourceBuffer();
+
+    SourceBuffer(const SourceBuffer&) = delete;
+    SourceBuffer& operator=(const SourceBuffer&) = delete;
+
+    SourceBuffer(SourceBuffer&& other) noexcept;
+    SourceBuffer& operator=(SourceBuffer&& other) noexcept;
+
+    /**
+     * Loads the entire content of a file into the buffer.
+     * The previous content of the buffer will be released.
+     *
+     * @param path     - Path to the file that will be loaded.
+     * @param map_file - If false, the file is always read into memory.
+     *                   Used for buffers that are kept alive for a long
+     *                   time, while the file might be changed on disk.
+     * @return true if the file was loaded, false if the file could not be
+     *         opened or read.
+     */
+    bool Open(const std::string& path, bool map_file = true);
+
+    /**
+     * Sets the buffer to a view of existing data. The data is not copied
+     * and has to stay valid until the buffer is closed.
+     * The previous content of the buffer will be released.
+     *
+     * @param data - Data that will be accessed through the buffer.
+     */
+    void OpenView(std::string_view data);
+
+    /**
+     * Releases the content of the buffer.
+     */
+    void Close();
+
+    inline const char* Begin()  const { return this->data_; }
+    inline const char* End()    const { return this->data_ + this->size_; }
+    inline size_t      Size()   const { return this->size_; }
+    inline bool        IsOpen() const { return this->data_ != nullptr; }
+
+private:
+    /**
+     * Loads the file by reading it into the storage or by memory mapping it.
+     */
+    bool Read(const std::string& path);
+    bool Map(const std::string& path);
+
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+
+    /**
+     * Set if data_ points to a memory mapped file.
+     */
+    bool mapped_ = false;
+
+    /**
+     * Owns the data if the file is not memory mapped.
+     */
+    internal::MemoryBlock<char, MemorySubsystem::kLexer> storage_;
+};
+
+}  // namespace imgui_markup::internal::parser
+
+#endif  // IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_PARSER_SOURCE_BUFFER_H_
@@ -0,0 +1,52 @@
+#ifndef IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_PARSER_SOURCE_LOCATION_H_
+#define IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_PARSER_SOURCE_LOCATION_H_
+
+#include <cstdint>
+
+namespace imgui_markup::internal::parser
+{
+
+/**
+ * File ID used by locations that do not belong to any file.
+ */
+constexpr uint16_t kInvalidFileID = UINT16_MAX;
+
+/**
+ * Compact location of a range of characters inside a source file.
+ * The location can be converted to a ParserPosition by the lexer that
+ * loaded the file. This is only done when an error is reported.
+ */
+struct SourceLocation
+{
+    /**
+     * Offset of the first character and number of characters,
+     * relative to the start of the file.
+     */
+    uint32_t offset = 0;
+    uint32_t length = 0;
+
+    /**
+     * ID of the file inside the lexer. Every file that is opened by the
+     * lexer, including every include, gets its own ID.
+     */
+    uint16_t file_id = kInvalidFileID;
+
+    /**
+     * Returns a location that starts at this location and ends at the end
+     * of the given location. If the other location is inside a different
+     * file or before this location, this location is returned unchanged.
+     */
+    inline SourceLocation Extend(const SourceLocation& other) const
+    {
+        if (other.file_id != this->file_id || other.offset < this->offset)
+            return *this;
+
+        SourceLocation location = *this;
+        location.length = other.offset + other.length - this->offset;
+        return location;
+    }
+};
+
+}  // namespace imgui_markup::internal::parser
+
+#endif  // IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_PARSER_SOURCE_LOCATION_H_
@@ -0,0 +1,24 @@
+#ifndef IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_PARSER_VIRTUAL_FILE_SYSTEM_H_
+#define IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_PARSER_VIRTUAL_FILE_SYSTEM_H_
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace imgui_markup
+{
+
+/**
+ * Maps file paths to the content of in-memory files.
+ * Used to parse files, including every file that is loaded through an
+ * include instruction, without accessing the filesystem.
+ * The paths are relative, use '/' as a separator and do not contain
+ * "." or ".." segments, e.g. "ui/buttons.ill".
+ * The parser does not copy the content, so the data has to stay valid
+ * while the files are parsed.
+ */
+using VirtualFileSystem = std::unordered_map<std::string, std::string_view>;
+
+}  // namespace imgui_markup
+
+#endif  // IMGUI_MARKUP_INCLUDE_IMGUI_MARKUP_PARSER_VIRTUAL_FILE_SYSTEM_H_
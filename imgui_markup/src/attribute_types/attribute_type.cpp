@@ -1,6 +1,14 @@
 #include "impch.h"
 #include "imgui_markup/attribute_types/attribute_type.h"
 
+#include "imgui_markup/attribute_types/bool.h"
+#include "imgui_markup/attribute_types/float.h"
+#include "imgui_markup/attribute_types/float2.h"
+#include "imgui_markup/attribute_types/float3.h"
+#include "imgui_markup/attribute_types/float4.h"
+#include "imgui_markup/attribute_types/int.h"
+#include "imgui_markup/attribute_types/string.h"
+
 namespace imgui_markup
 {
 
@@ -8,54 +16,116 @@ Attribute::Attribute(AttributeType type)
     : type(type)
 { }
 
-bool Attribute::LoadValue(const Attribute& value)
+bool Attribute::LoadValue(const AttributeValue& value)
 {
-    switch (value.type)
+    if (value.GetType() == this->type)
     {
-    case AttributeType::kBool:   return this->LoadValue<Bool>((Bool&)value);
-    case AttributeType::kFloat:  return this->LoadValue<Float>((Float&)value);
-    case AttributeType::kFloat2: return this->LoadValue<Float2>((Float2&)value);
-    case AttributeType::kFloat3: return this->LoadValue<Float3>((Float3&)value);
-    case AttributeType::kFloat4: return this->LoadValue<Float4>((Float4&)value);
-    case AttributeType::kInt:    return this->LoadValue<Int>((Int&)value);
-    case AttributeType::kString: return this->LoadValue<String>((String&)value);
-    default: return false;
+        this->StoreValue(value);
     }
-}
-
-bool Attribute::LoadValue(const Bool& value_in)
-{
-    return this->LoadValue<Bool>(value_in);
-}
+    else
+    {
+        AttributeValue converted;
+        if (!value.ConvertTo(this->type, converted))
+            return false;
 
-bool Attribute::LoadValue(const Float& value_in)
-{
-    return this->LoadValue<Float>(value_in);
-}
+        this->StoreValue(converted);
+    }
 
-bool Attribute::LoadValue(const Float2& value_in)
-{
-    return this->LoadValue<Float2>(value_in);
+    this->value_changed_ = true;
+    return true;
 }
 
-bool Attribute::LoadValue(const Float3& value_in)
+bool Attribute::LoadValue(const Attribute& value)
 {
-    return this->LoadValue<Float3>(value_in);
+    return this->LoadValue(value.GetValue());
 }
 
-bool Attribute::LoadValue(const Float4& value_in)
+AttributeValue Attribute::GetValue() const
 {
-    return this->LoadValue<Float4>(value_in);
+    switch (this->type)
+    {
+    case AttributeType::kBool:
+        return AttributeValue(static_cast<const Bool&>(*this).value);
+    case AttributeType::kFloat:
+        return AttributeValue(static_cast<const Float&>(*this).value);
+    case AttributeType::kFloat2:
+    {
+        const Float2& value = static_cast<const Float2&>(*this);
+        return AttributeValue(AttributeValue::Vector2{ value.x, value.y });
+    }
+    case AttributeType::kFloat3:
+    {
+        const Float3& value = static_cast<const Float3&>(*this);
+        return AttributeValue(
+            AttributeValue::Vector3{ value.x, value.y, value.z });
+    }
+    case AttributeType::kFloat4:
+    {
+        const Float4& value = static_cast<const Float4&>(*this);
+        return AttributeValue(
+            AttributeValue::Vector4{ value.x, value.y, value.z, value.w });
+    }
+    case AttributeType::kInt:
+        return AttributeValue(static_cast<const Int&>(*this).value);
+    case AttributeType::kString:
+        return AttributeValue(static_cast<const String&>(*this).value);
+    default:
+        return AttributeValue();
+    }
 }
 
-bool Attribute::LoadValue(const Int& value_in)
+std::string Attribute::ToString() const
 {
-    return this->LoadValue<Int>(value_in);
+    return this->GetValue().ToString();
 }
 
-bool Attribute::LoadValue(const String& value_in)
+void Attribute::StoreValue(const AttributeValue& value)
 {
-    return this->LoadValue<String>(value_in);
+    switch (this->type)
+    {
+    case AttributeType::kBool:
+        static_cast<Bool&>(*this).value = value.Get<bool>();
+        break;
+    case AttributeType::kFloat:
+        static_cast<Float&>(*this).value = value.Get<float>();
+        break;
+    case AttributeType::kFloat2:
+    {
+        const AttributeValue::Vector2& vector =
+            value.Get<AttributeValue::Vector2>();
+        Float2& dest = static_cast<Float2&>(*this);
+        dest.x = vector[0];
+        dest.y = vector[1];
+        break;
+    }
+    case AttributeType::kFloat3:
+    {
+        const AttributeValue::Vector3& vector =
+            value.Get<AttributeValue::Vector3>();
+        Float3& dest = static_cast<Float3&>(*this);
+        dest.x = vector[0];
+        dest.y = vector[1];
+        dest.z = vector[2];
+        break;
+    }
+    case AttributeType::kFloat4:
+    {
+        const AttributeValue::Vector4& vector =
+            value.Get<AttributeValue::Vector4>();
+        Float4& dest = static_cast<Float4&>(*this);
+        dest.x = vector[0];
+        dest.y = vector[1];
+        dest.z = vector[2];
+        dest.w = vector[3];
+        break;
+    }
+    case AttributeType::kInt:
+        static_cast<Int&>(*this).value = value.Get<int>();
+        break;
+    case AttributeType::kString:
+        static_cast<String&>(*this).value = value.Get<std::string>();
+        break;
+    }
 }
 
 }  // namespace imgui_markup
@@ -0,0 +1,208 @@
+#include "impch.h"
+#include "imgui_markup/attribute_types/attribute_value.h"
+
+#include "imgui_markup/attribute_types/attribute_type.h"
+
+namespace imgui_markup
+{
+
+namespace
+{
+
+using Conversion = bool (*)(const AttributeValue& value,
+                            AttributeValue& dest);
+
+template<size_t kType>
+using StoredType =
+    std::variant_alternative_t<kType, AttributeValue::Storage>;
+
+constexpr size_t kStringIndex = static_cast<size_t>(AttributeType::kString);
+
+/**
+ * Splits a string by ',' and converts every segment to a float. Same as
+ * SplitString, a trailing empty segment is ignored.
+ */
+template<size_t kCount>
+bool StringToVector(std::string_view str, std::array<float, kCount>& dest)
+{
+    size_t count = 0;
+    size_t start = 0;
+    while (start < str.size())
+    {
+        const size_t end = std::min(str.find(',', start), str.size());
+
+        if (count >= kCount)
+            return false;
+
+        if (!internal::utils::StringToFloat(
+            str.substr(start, end - start), &dest[count]))
+            return false;
+
+        count++;
+        start = end + 1;
+    }
+
+    return count == kCount;
+}
+
+std::string FloatsToString(const float* values, size_t count,
+                           const char* separator)
+{
+    std::string str;
+    for (size_t i = 0; i < count; i++)
+    {
+        if (i != 0)
+            str += separator;
+
+        str += std::to_string(values[i]);
+    }
+
+    return str;
+}
+
+/**
+ * Conversion from one attribute type to another. The types without a
+ * specialization can not be converted.
+ */
+template<size_t kFrom, size_t kTo, typename = void>
+struct Converter
+{
+    static constexpr Conversion kFunction = nullptr;
+};
+
+// Every type can be loaded from itself
+template<size_t kType>
+struct Converter<kType, kType>
+{
+    static bool Convert(const AttributeValue& value, AttributeValue& dest)
+    {
+        dest = value;
+        return true;
+    }
+
+    static constexpr Conversion kFunction = &Convert;
+};
+
+// Every type can be converted to a String
+template<size_t kFrom>
+struct Converter<kFrom, kStringIndex,
+                 std::enable_if_t<kFrom != kStringIndex>>
+{
+    static bool Convert(const AttributeValue& value, AttributeValue& dest)
+    {
+        dest = AttributeValue(value.ToString());
+        return true;
+    }
+
+    static constexpr Conversion kFunction = &Convert;
+};
+
+// A String can be parsed as every type
+template<size_t kTo>
+struct Converter<kStringIndex, kTo,
+                 std::enable_if_t<kTo != kStringIndex>>
+{
+    static bool Convert(const AttributeValue& value, AttributeValue& dest)
+    {
+        const std::string& str = value.Get<std::string>();
+
+        StoredType<kTo> result{ };
+        if constexpr (std::is_same_v<StoredType<kTo>, bool>)
+        {
+            if (!internal::utils::StringToBool(str, &result))
+                return false;
+        }
+        else if constexpr (std::is_same_v<StoredType<kTo>, int>)
+        {
+            if (!internal::utils::StringToInt(str, &result))
+                return false;
+        }
+        else if constexpr (std::is_same_v<StoredType<kTo>, float>)
+        {
+            if (!internal::utils::StringToFloat(str, &result))
+                return false;
+        }
+        else
+        {
+            if (!StringToVector(str, result))
+                return false;
+        }
+
+        dest = AttributeValue(result);
+        return true;
+    }
+
+    static constexpr Conversion kFunction = &Convert;
+};
+
+template<size_t kFrom, size_t... kTo>
+constexpr std::array<Conversion, sizeof...(kTo)> MakeConversionRow(
+    std::index_sequence<kTo...>)
+{
+    return { Converter<kFrom, kTo>::kFunction... };
+}
+
+template<size_t... kFrom>
+constexpr std::array<std::array<Conversion, sizeof...(kFrom)>,
+                     sizeof...(kFrom)>
+MakeConversionMatrix(std::index_sequence<kFrom...> types)
+{
+    return { MakeConversionRow<kFrom>(types)... };
+}
+
+/**
+ * Conversion functions indexed by [from][to], nullptr if the types can
+ * not be converted.
+ */
+constexpr auto kConversionMatrix = MakeConversionMatrix(
+    std::make_index_sequence<AttributeValue::kTypeCount>());
+
+}  // namespace
+
+AttributeType AttributeValue::GetType() const
+{
+    return static_cast<AttributeType>(this->value_.index());
+}
+
+bool AttributeValue::ConvertTo(AttributeType type,
+                               AttributeValue& dest) const
+{
+    const Conversion conversion = kConversionMatrix
+        [this->value_.index()][static_cast<size_t>(type)];
+
+    if (!conversion)
+        return false;
+
+    return conversion(*this, dest);
+}
+
+std::string AttributeValue::ToString() const
+{
+    switch (this->GetType())
+    {
+    case AttributeType::kBool:
+        return internal::utils::BoolToString(this->Get<bool>());
+    case AttributeType::kFloat:
+        return std::to_string(this->Get<float>());
+    case AttributeType::kFloat2:
+        return FloatsToString(this->Get<Vector2>().data(), 2, ", ");
+    case AttributeType::kFloat3:
+        return FloatsToString(this->Get<Vector3>().data(), 3, ",");
+    case AttributeType::kFloat4:
+        return FloatsToString(this->Get<Vector4>().data(), 4, ",");
+    case AttributeType::kInt:
+        return std::to_string(this->Get<int>());
+    case AttributeType::kString:
+        return this->Get<std::string>();
+    default:
+        return std::string();
+    }
+}
+
+bool AttributeValue::IsConvertible(AttributeType from, AttributeType to)
+{
+    return kConversionMatrix
+        [static_cast<size_t>(from)][static_cast<size_t>(to)] != nullptr;
+}
+
+}  // namespace imgui_markup
@@ -0,0 +1,226 @@
+#include "impch.h"
+#include "imgui_markup/common/atom.h"
+
+#include <array>
+#include <atomic>
+#include <deque>
+#include <iterator>
+#include <memory>
+#include <mutex>
+
+namespace imgui_markup
+{
+
+namespace
+{
+
+/**
+ * Names of the builtin atoms, in the order of atoms::Builtin.
+ */
+const char* const kBuiltinNames[] = {
+    "", "global",
+    "GlobalObject", "Panel", "ChildPanel", "Button", "ButtonStyle", "Text",
+    "Container", "Bool", "Float", "Float2", "Float3", "Float4", "Int", "String",
+    "author", "border", "color", "color_active", "color_hovered", "date",
+    "description", "id", "position", "size", "text", "title", "value",
+    "version"
+};
+
+static_assert(std::size(kBuiltinNames) == atoms::kBuiltinCount,
+              "Every builtin atom needs a name");
+
+class AtomTable
+{
+public:
+    static AtomTable& Get()
+    {
+        static AtomTable instance;
+        return instance;
+    }
+
+    uint32_t Insert(std::string_view name)
+    {
+        const size_t hash = std::hash<std::string_view>()(name);
+
+        uint32_t id;
+        if (this->Find(name, hash, id))
+            return id;
+
+        std::lock_guard<std::mutex> lock(this->mutex_);
+
+        // The name could have been inserted by another thread in between
+        if (this->Find(name, hash, id))
+            return id;
+
+        id = static_cast<uint32_t>(this->names_.size());
+        const size_t chunk = id / kChunkSize;
+
+        if (chunk >= kMaxChunks)
+            throw AtomTableFull();
+
+        if (id % kChunkSize == 0)
+        {
+            this->chunk_storage_.emplace_back(
+                new const std::string*[kChunkSize]);
+            this->chunks_[chunk].store(this->chunk_storage_.back().get(),
+                                       std::memory_order_release);
+        }
+
+        // A deque never moves its elements, so the names stay valid
+        this->chunks_[chunk].load(std::memory_order_relaxed)[id % kChunkSize] =
+            &this->names_.emplace_back(name);
+
+        // Keep the load factor below 50%
+        Slots* slots = this->slots_.load(std::memory_order_relaxed);
+        if ((id + 1) * 2 > slots->size)
+            slots = this->Grow(*slots);
+
+        this->InsertSlot(*slots, hash, id);
+
+        return id;
+    }
+
+    /**
+     * Does not lock the table. Slots are only published after the name
+     * was stored, so a name that was found can always be read.
+     */
+    bool Find(std::string_view name, size_t hash, uint32_t& dest) const
+    {
+        const Slots* slots = this->slots_.load(std::memory_order_acquire);
+        const uint32_t tag = HashTag(hash);
+
+        for (size_t i = hash & (slots->size - 1); ;
+             i = (i + 1) & (slots->size - 1))
+        {
+            const uint64_t slot =
+                slots->data[i].load(std::memory_order_acquire);
+
+            if (slot == 0)
+                return false;
+
+            if (static_cast<uint32_t>(slot >> 32) != tag)
+                continue;
+
+            const uint32_t id = static_cast<uint32_t>(slot);
+            if (this->GetName(id) == name)
+            {
+                dest = id;
+                return true;
+            }
+        }
+    }
+
+    const std::string& GetName(uint32_t id) const
+    {
+        return *this->chunks_[id / kChunkSize].load(
+            std::memory_order_acquire)[id % kChunkSize];
+    }
+
+private:
+    static constexpr size_t kChunkSize = 1024;
+    static constexpr size_t kMaxChunks = 4096;
+
+    /**
+     * Open addressing hash table. Every slot stores the hash tag in the
+     * upper and the atom ID in the lower 32 bits.
+     */
+    struct Slots
+    {
+        explicit Slots(size_t size)
+            : size(size), data(new std::atomic<uint64_t>[size])
+        {
+            for (size_t i = 0; i < size; i++)
+                this->data[i].store(0, std::memory_order_relaxed);
+        }
+
+        const size_t size;
+        std::unique_ptr<std::atomic<uint64_t>[]> data;
+    };
+
+    /**
+     * Only used to insert names, reading is done without any lock.
+     */
+    std::mutex mutex_;
+
+    std::deque<std::string> names_;
+
+    /**
+     * Maps atom IDs to names. The chunks are never reallocated, so they
+     * can be read without locking the table.
+     */
+    std::array<std::atomic<const std::string**>, kMaxChunks> chunks_ = { };
+    std::vector<std::unique_ptr<const std::string*[]>> chunk_storage_;
+
+    /**
+     * Current hash table. Old tables are kept alive, because other threads
+     * could still be searching inside of them.
+     */
+    std::atomic<Slots*> slots_;
+    std::vector<std::unique_ptr<Slots>> slot_storage_;
+
+    AtomTable()
+    {
+        this->slot_storage_.emplace_back(new Slots(256));
+        this->slots_.store(this->slot_storage_.back().get(),
+                           std::memory_order_release);
+
+        for (const char* name : kBuiltinNames)
+            this->Insert(name);
+    }
+
+    /**
+     * Upper bits of the hash, with the lowest bit set so that a used slot
+     * is never 0.
+     */
+    static uint32_t HashTag(size_t hash)
+    {
+        return static_cast<uint32_t>(static_cast<uint64_t>(hash) >> 32) | 1;
+    }
+
+    static void InsertSlot(Slots& slots, size_t hash, uint32_t id)
+    {
+        const uint32_t tag = HashTag(hash);
+
+        size_t i = hash & (slots.size - 1);
+        while (slots.data[i].load(std::memory_order_relaxed) != 0)
+            i = (i + 1) & (slots.size - 1);
+
+        slots.data[i].store((static_cast<uint64_t>(tag) << 32) | id,
+                            std::memory_order_release);
+    }
+
+    Slots* Grow(const Slots& old_slots)
+    {
+        this->slot_storage_.emplace_back(new Slots(old_slots.size * 2));
+        Slots* slots = this->slot_storage_.back().get();
+
+        for (uint32_t id = 0; id < this->names_.size() - 1; id++)
+        {
+            const size_t hash =
+                std::hash<std::string_view>()(this->GetName(id));
+            InsertSlot(*slots, hash, id);
+        }
+
+        this->slots_.store(slots, std::memory_order_release);
+        return slots;
+    }
+};
+
+}  // namespace
+
+Atom::Atom(std::string_view name)
+    : id_(AtomTable::Get().Insert(name))
+{ }
+
+bool Atom::Find(std::string_view name, Atom& dest)
+{
+    return AtomTable::Get().Find(
+        name, std::hash<std::string_view>()(name), dest.id_);
+}
+
+const std::string& Atom::String() const
+{
+    return AtomTable::Get().GetName(this->id_);
+}
+
+}  // namespace imgui_markup
@@ -0,0 +1,267 @@
+#include "impch.h"
+#include "imgui_markup/common/memory.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace imgui_markup
+{
+
+namespace
+{
+
+void* DefaultAlloc(size_t size, void* /* user_data */)
+{
+    return std::malloc(size);
+}
+
+void DefaultFree(void* pointer, void* /* user_data */)
+{
+    std::free(pointer);
+}
+
+MemoryAllocFunction g_alloc_function = &DefaultAlloc;
+MemoryFreeFunction  g_free_function  = &DefaultFree;
+void*               g_user_data      = nullptr;
+
+/**
+ * Counters of a subsystem. Updated by every thread that parses a file,
+ * so the counters are atomic.
+ */
+struct MemoryCounters
+{
+    std::atomic<uint64_t> allocations = 0;
+    std::atomic<uint64_t> frees = 0;
+    std::atomic<uint64_t> bytes_in_use = 0;
+    std::atomic<uint64_t> peak_bytes_in_use = 0;
+};
+
+MemoryCounters g_counters[static_cast<size_t>(MemorySubsystem::kCount)];
+
+inline MemoryCounters& GetCounters(MemorySubsystem subsystem)
+{
+    return g_counters[static_cast<size_t>(subsystem)];
+}
+
+/**
+ * Memory resource of a single subsystem. Memory with a larger alignment
+ * than the allocate functions guarantee is over-allocated, the pointer
+ * returned by the allocate function is stored in front of the memory.
+ */
+class SubsystemMemoryResource : public std::pmr::memory_resource
+{
+public:
+    SubsystemMemoryResource() = default;
+
+    void Init(MemorySubsystem subsystem) { this->subsystem_ = subsystem; }
+
+private:
+    MemorySubsystem subsystem_ = MemorySubsystem::kUser;
+
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+        if (alignment <= alignof(std::max_align_t))
+            return internal::MemoryAlloc(bytes, this->subsystem_);
+
+        char* memory = static_cast<char*>(
+            internal::MemoryAlloc(bytes + alignment, this->subsystem_));
+
+        const uintptr_t address = reinterpret_cast<uintptr_t>(memory);
+        char* aligned = memory + (alignment - address % alignment);
+        reinterpret_cast<char**>(aligned)[-1] = memory;
+
+        return aligned;
+    }
+
+    void do_deallocate(void* pointer, size_t bytes,
+                       size_t alignment) override
+    {
+        if (alignment <= alignof(std::max_align_t))
+        {
+            internal::MemoryFree(pointer, bytes, this->subsystem_);
+            return;
+        }
+
+        internal::MemoryFree(reinterpret_cast<char**>(pointer)[-1],
+                             bytes + alignment, this->subsystem_);
+    }
+
+    bool do_is_equal(
+        const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+}  // namespace
+
+void SetAllocatorFunctions(MemoryAllocFunction alloc_function,
+                           MemoryFreeFunction free_function,
+                           void* user_data)
+{
+    g_alloc_function = alloc_function;
+    g_free_function  = free_function;
+    g_user_data      = user_data;
+}
+
+void GetAllocatorFunctions(MemoryAllocFunction* alloc_function,
+                           MemoryFreeFunction* free_function,
+                           void** user_data)
+{
+    *alloc_function = g_alloc_function;
+    *free_function  = g_free_function;
+    *user_data      = g_user_data;
+}
+
+MemoryStatistics GetMemoryStatistics(MemorySubsystem subsystem)
+{
+    const MemoryCounters& counters = GetCounters(subsystem);
+
+    MemoryStatistics statistics;
+    statistics.allocations       = counters.allocations;
+    statistics.frees             = counters.frees;
+    statistics.bytes_in_use      = counters.bytes_in_use;
+    statistics.peak_bytes_in_use = counters.peak_bytes_in_use;
+
+    return statistics;
+}
+
+void ResetMemoryStatistics()
+{
+    for (MemoryCounters& counters : g_counters)
+    {
+        counters.allocations = 0;
+        counters.frees       = 0;
+        counters.peak_bytes_in_use = counters.bytes_in_use.load();
+    }
+}
+
+std::pmr::memory_resource* GetMemoryResource(MemorySubsystem subsystem)
+{
+    // Never destroyed, so that the resources can be used by objects with
+    // static storage duration
+    static SubsystemMemoryResource* const resources = []()
+    {
+        constexpr size_t kCount = static_cast<size_t>(MemorySubsystem::kCount);
+
+        SubsystemMemoryResource* resources =
+            new SubsystemMemoryResource[kCount];
+
+        for (size_t i = 0; i < kCount; i++)
+            resources[i].Init(static_cast<MemorySubsystem>(i));
+
+        return resources;
+    }();
+
+    return &resources[static_cast<size_t>(subsystem)];
+}
+
+namespace internal
+{
+
+void* MemoryAlloc(size_t size, MemorySubsystem subsystem)
+{
+    void* pointer = g_alloc_function(size, g_user_data);
+    if (!pointer)
+        throw std::bad_alloc();
+
+    MemoryCounters& counters = GetCounters(subsystem);
+    counters.allocations.fetch_add(1, std::memory_order_relaxed);
+
+    const uint64_t bytes_in_use = counters.bytes_in_use.fetch_add(
+        size, std::memory_order_relaxed) + size;
+
+    uint64_t peak = counters.peak_bytes_in_use.load(
+        std::memory_order_relaxed);
+    while (bytes_in_use > peak &&
+           !counters.peak_bytes_in_use.compare_exchange_weak(
+               peak, bytes_in_use, std::memory_order_relaxed))
+    { }
+
+    return pointer;
+}
+
+void MemoryFree(void* pointer, size_t size,
+                MemorySubsystem subsystem) noexcept
+{
+    if (!pointer)
+        return;
+
+    MemoryCounters& counters = GetCounters(subsystem);
+    counters.frees.fetch_add(1, std::memory_order_relaxed);
+    counters.bytes_in_use.fetch_sub(size, std::memory_order_relaxed);
+
+    g_free_function(pointer, g_user_data);
+}
+
+SlabPool::SlabPool(MemorySubsystem subsystem)
+    : subsystem_(subsystem)
+{ }
+
+SlabPool::~SlabPool()
+{
+    while (this->slabs_)
+    {
+        char* previous = *reinterpret_cast<char**>(this->slabs_);
+        MemoryFree(this->slabs_, kSlabSize, this->subsystem_);
+        this->slabs_ = previous;
+    }
+}
+
+void* SlabPool::Allocate(size_t size)
+{
+    const size_t size_class = (std::max<size_t>(size, 1) - 1) / kGranularity;
+    if (size_class >= kSizeClassCount)
+        return MemoryAlloc(size, this->subsystem_);
+
+    FreeSlot*& free_list = this->free_lists_[size_class];
+    if (free_list)
+    {
+        FreeSlot* slot = free_list;
+        free_list = slot->next;
+        return slot;
+    }
+
+    const size_t slot_size = (size_class + 1) * kGranularity;
+    // There is no slab before the first allocation, the remaining space
+    // is only computed when there is one
+    if (!this->cursor_ ||
+        slot_size > static_cast<size_t>(this->end_ - this->cursor_))
+    {
+        // The rest of the current slab is not used anymore
+        char* slab = static_cast<char*>(
+            MemoryAlloc(kSlabSize, this->subsystem_));
+
+        *reinterpret_cast<char**>(slab) = this->slabs_;
+        this->slabs_  = slab;
+        this->cursor_ = slab + kGranularity;
+        this->end_    = slab + kSlabSize;
+    }
+
+    void* memory = this->cursor_;
+    this->cursor_ += slot_size;
+
+    return memory;
+}
+
+void SlabPool::Free(void* pointer, size_t size) noexcept
+{
+    if (!pointer)
+        return;
+
+    const size_t size_class = (std::max<size_t>(size, 1) - 1) / kGranularity;
+    if (size_class >= kSizeClassCount)
+    {
+        MemoryFree(pointer, size, this->subsystem_);
+        return;
+    }
+
+    FreeSlot* slot = static_cast<FreeSlot*>(pointer);
+    slot->next = this->free_lists_[size_class];
+    this->free_lists_[size_class] = slot;
+}
+
+}  // namespace internal
+
+}  // namespace imgui_markup
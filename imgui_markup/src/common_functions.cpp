@@ -2,15 +2,156 @@
 #include "imgui_markup/common_functions.h"
 
 #include "imgui_markup/parser/parser.h"
+#include "imgui_markup/parser/parser_session.h"
+#include "parser/compiled_file.h"
+#include "parser/include_cache.h"
+#include "parser/include_prefetcher.h"
+#include "parser/parse_cache.h"
+#include "utility/thread_pool.h"
+
+#include <cstdint>
+#include <exception>
+#include <mutex>
 
 namespace imgui_markup
 {
 
-ParserResult ParseFile(const char* path, GlobalObject& global_object)
+ParserResult ParseFile(const char* path, GlobalObject& global_object,
+                       ParserMode mode)
 {
-    internal::parser::Parser parser;
+    internal::parser::Parser parser(mode);
 
     return parser.ParseFile(path, global_object);
 }
 
+std::vector<ParserResult> ParseFiles(const char* const* paths,
+                                     GlobalObject* global_objects,
+                                     size_t count, ParserMode mode)
+{
+    std::vector<ParserResult> results(count);
+    std::vector<std::exception_ptr> errors(count);
+
+    if (count == 0)
+        return results;
+
+    internal::utils::ThreadPool& pool =
+        internal::parser::IncludePrefetcher::GetThreadPool();
+
+    // Only one session per thread is created, instead of a parser
+    // per file
+    ParserSessionPool sessions(mode, pool.GetThreadCount() + 1);
+
+    // Only the counter is accessed by the last task after the caller can
+    // return, and only while the mutex is locked
+    std::mutex mutex;
+    size_t remaining = count;
+
+    // Every task only writes to its own result, error and global object
+    for (size_t i = 0; i < count; i++)
+    {
+        pool.Submit([&, i]()
+        {
+            try
+            {
+                ParserSessionPool::Lease session = sessions.Acquire();
+                results[i] = session->ParseFile(paths[i], global_objects[i]);
+            }
+            catch (...)
+            {
+                errors[i] = std::current_exception();
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            remaining--;
+        });
+    }
+
+    // The calling thread parses files as well while waiting. It is not a
+    // task itself, so it can start whole files.
+    while (true)
+    {
+        // Read before the counter is checked, see WaitForProgress
+        const uint64_t progress = pool.GetProgress();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (remaining == 0)
+                break;
+        }
+
+        if (pool.RunPendingTask())
+            continue;
+
+        // New include tasks might be submitted while the last files are
+        // parsed by the worker threads
+        pool.WaitForProgress(progress);
+    }
+
+    for (const auto& error : errors)
+    {
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    return results;
+}
+
+ParserResult ParseData(std::string_view data, GlobalObject& global_object,
+                       ParserMode mode)
+{
+    internal::parser::Parser parser(mode);
+
+    return parser.ParseData(data, global_object);
+}
+
+ParserResult ParseBuffers(const char* path, const VirtualFileSystem& files,
+                          GlobalObject& global_object, ParserMode mode)
+{
+    internal::parser::Parser parser(mode);
+
+    return parser.ParseBuffers(path, files, global_object);
+}
+
+ParserResult CompileFile(const char* path, const char* output_path)
+{
+    GlobalObject global_object;
+
+    internal::parser::Parser parser(ParserMode::kNodeTree);
+
+    const ParserResult result = parser.ParseFile(path, global_object);
+    if (!result)
+        return result;
+
+    internal::parser::CompiledFile compiled_file;
+
+    return compiled_file.Write(global_object, output_path);
+}
+
+ParserResult LoadCompiledFile(const char* path, GlobalObject& global_object)
+{
+    internal::parser::CompiledFile compiled_file;
+
+    return compiled_file.Load(path, global_object);
+}
+
+void EnableParseCache(const char* directory, uint64_t max_size)
+{
+    internal::parser::ParseCache::Get().Enable(directory, max_size);
+}
+
+void DisableParseCache()
+{
+    internal::parser::ParseCache::Get().Disable();
+}
+
+ParseCacheStatistics GetParseCacheStatistics()
+{
+    return internal::parser::ParseCache::Get().GetStatistics();
+}
+
+void ClearIncludeCache()
+{
+    internal::parser::IncludeCache::Get().Clear();
+}
+
 }  // namespace imgui_markup
@@ -21,5 +21,6 @@
 #include <sstream>
 #include <fstream>
 #include <filesystem>
+#include <algorithm>
 
 #endif  // IMGUI_MARKUP_SRC_ILPCH_H_
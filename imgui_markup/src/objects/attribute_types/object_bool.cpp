@@ -4,16 +4,24 @@
 namespace imgui_markup
 {
 
-ObjectBool::ObjectBool(std::string id, Object* parent)
-    : Object("Bool", id, parent)
+ObjectBool::ObjectBool(Atom id, Object* parent)
+    : Object(atoms::kBool, id, parent)
+{ }
+
+const AttributeTable& ObjectBool::GetAttributeTable() const
 {
-    this->AddAttribute("value", &this->value);
+    static const AttributeTable table = {
+        DescribeAttribute<ObjectBool, &ObjectBool::value>(
+            atoms::kAttributeValue)
+    };
+
+    return table;
 }
 
 ObjectBool& ObjectBool::operator=(const ObjectBool& other)
 {
-    for (auto& child : this->child_objects_)
-        child->SetParent(other.parent_);
+    for (Object& child : this->GetChildren())
+        child.SetParent(other.parent_);
 
     return *this;
 }
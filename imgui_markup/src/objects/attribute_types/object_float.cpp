@@ -4,16 +4,24 @@
 namespace imgui_markup
 {
 
-ObjectFloat::ObjectFloat(std::string id, Object* parent)
-    : Object("Float", id, parent)
+ObjectFloat::ObjectFloat(Atom id, Object* parent)
+    : Object(atoms::kFloat, id, parent)
+{ }
+
+const AttributeTable& ObjectFloat::GetAttributeTable() const
 {
-    this->AddAttribute("value", &this->value);
+    static const AttributeTable table = {
+        DescribeAttribute<ObjectFloat, &ObjectFloat::value>(
+            atoms::kAttributeValue)
+    };
+
+    return table;
 }
 
 ObjectFloat& ObjectFloat::operator=(const ObjectFloat& other)
 {
-    for (auto& child : this->child_objects_)
-        child->SetParent(other.parent_);
+    for (Object& child : this->GetChildren())
+        child.SetParent(other.parent_);
 
     return *this;
 }
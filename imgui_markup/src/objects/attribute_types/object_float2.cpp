@@ -4,16 +4,24 @@
 namespace imgui_markup
 {
 
-ObjectFloat2::ObjectFloat2(std::string id, Object* parent)
-    : Object("Float2", id, parent)
+ObjectFloat2::ObjectFloat2(Atom id, Object* parent)
+    : Object(atoms::kFloat2, id, parent)
+{ }
+
+const AttributeTable& ObjectFloat2::GetAttributeTable() const
 {
-    this->AddAttribute("value", &this->value);
+    static const AttributeTable table = {
+        DescribeAttribute<ObjectFloat2, &ObjectFloat2::value>(
+            atoms::kAttributeValue)
+    };
+
+    return table;
 }
 
 ObjectFloat2& ObjectFloat2::operator=(const ObjectFloat2& other)
 {
-    for (auto& child : this->child_objects_)
-        child->SetParent(other.parent_);
+    for (Object& child : this->GetChildren())
+        child.SetParent(other.parent_);
 
     return *this;
 }
@@ -4,16 +4,24 @@
 namespace imgui_markup
 {
 
-ObjectFloat3::ObjectFloat3(std::string id, Object* parent)
-    : Object("Float3", id, parent)
+ObjectFloat3::ObjectFloat3(Atom id, Object* parent)
+    : Object(atoms::kFloat3, id, parent)
+{ }
+
+const AttributeTable& ObjectFloat3::GetAttributeTable() const
 {
-    this->AddAttribute("value", &this->value);
+    static const AttributeTable table = {
+        DescribeAttribute<ObjectFloat3, &ObjectFloat3::value>(
+            atoms::kAttributeValue)
+    };
+
+    return table;
 }
 
 ObjectFloat3& ObjectFloat3::operator=(const ObjectFloat3& other)
 {
-    for (auto& child : this->child_objects_)
-        child->SetParent(other.parent_);
+    for (Object& child : this->GetChildren())
+        child.SetParent(other.parent_);
 
     return *this;
 }
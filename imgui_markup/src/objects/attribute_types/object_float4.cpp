@@ -4,16 +4,24 @@
 namespace imgui_markup
 {
 
-ObjectFloat4::ObjectFloat4(std::string id, Object* parent)
-    : Object("Float4", id, parent)
+ObjectFloat4::ObjectFloat4(Atom id, Object* parent)
+    : Object(atoms::kFloat4, id, parent)
+{ }
+
+const AttributeTable& ObjectFloat4::GetAttributeTable() const
 {
-    this->AddAttribute("value", &this->value);
+    static const AttributeTable table = {
+        DescribeAttribute<ObjectFloat4, &ObjectFloat4::value>(
+            atoms::kAttributeValue)
+    };
+
+    return table;
 }
 
 ObjectFloat4& ObjectFloat4::operator=(const ObjectFloat4& other)
 {
-    for (auto& child : this->child_objects_)
-        child->SetParent(other.parent_);
+    for (Object& child : this->GetChildren())
+        child.SetParent(other.parent_);
 
     return *this;
 }
@@ -4,16 +4,23 @@
 namespace imgui_markup
 {
 
-ObjectInt::ObjectInt(std::string id, Object* parent)
-    : Object("Int", id, parent)
+ObjectInt::ObjectInt(Atom id, Object* parent)
+    : Object(atoms::kInt, id, parent)
+{ }
+
+const AttributeTable& ObjectInt::GetAttributeTable() const
 {
-    this->AddAttribute("value", &this->value);
+    static const AttributeTable table = {
+        DescribeAttribute<ObjectInt, &ObjectInt::value>(atoms::kAttributeValue)
+    };
+
+    return table;
 }
 
 ObjectInt& ObjectInt::operator=(const ObjectInt& other)
 {
-    for (auto& child : this->child_objects_)
-        child->SetParent(other.parent_);
+    for (Object& child : this->GetChildren())
+        child.SetParent(other.parent_);
 
     return *this;
 }
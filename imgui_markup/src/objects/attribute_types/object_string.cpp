@@ -4,16 +4,24 @@
 namespace imgui_markup
 {
 
-ObjectString:: ObjectString(std::string id, Object* parent)
-    : Object("String", id, parent)
+ObjectString::ObjectString(Atom id, Object* parent)
+    : Object(atoms::kString, id, parent)
+{ }
+
+const AttributeTable& ObjectString::GetAttributeTable() const
 {
-    this->AddAttribute("value", &this->value);
+    static const AttributeTable table = {
+        DescribeAttribute<ObjectString, &ObjectString::value>(
+            atoms::kAttributeValue)
+    };
+
+    return table;
 }
 
 ObjectString& ObjectString::operator=(const ObjectString& other)
 {
-    for (auto& child : this->child_objects_)
-        child->SetParent(other.parent_);
+    for (Object& child : this->GetChildren())
+        child.SetParent(other.parent_);
 
     return *this;
 }
@@ -6,17 +6,24 @@
 namespace imgui_markup
 {
 
-Button::Button(std::string id, Object* parent)
-    : Object("Button", id, parent)
+Button::Button(Atom id, Object* parent)
+    : Object(atoms::kButton, id, parent)
+{ }
+
+const AttributeTable& Button::GetAttributeTable() const
 {
-    this->AddAttribute("size", &this->size_);
-    this->AddAttribute("text", &this->text_);
+    static const AttributeTable table = {
+        DescribeAttribute<Button, &Button::size_>(atoms::kAttributeSize),
+        DescribeAttribute<Button, &Button::text_>(atoms::kAttributeText)
+    };
+
+    return table;
 }
 
 Button& Button::operator=(const Button& other)
 {
-    for (auto& child : this->child_objects_)
-        child->SetParent(other.parent_);
+    for (Object& child : this->GetChildren())
+        child.SetParent(other.parent_);
 
     return *this;
 }
@@ -33,7 +40,10 @@ void Button::Update()
     else
         this->is_pressed_ = false;
 
-    this->is_hovered_ = ImGui::IsItemHovered();
+    if (this->is_pressed_)
+        this->PushEvent(ObjectEventType::kPressed, ImGuiMouseButton_Left);
+
+    this->SetHovered(ImGui::IsItemHovered());
     this->size_ = ImGui::GetItemRectSize();
 
     if (this->style_)
@@ -4,12 +4,22 @@
 namespace imgui_markup
 {
 
-ButtonStyle::ButtonStyle(std::string id, Object* parent)
-    : Object("ButtonStyle", id, parent)
+ButtonStyle::ButtonStyle(Atom id, Object* parent)
+    : Object(atoms::kButtonStyle, id, parent)
+{ }
+
+const AttributeTable& ButtonStyle::GetAttributeTable() const
 {
-    this->AddAttribute("color",         &this->color_);
-    this->AddAttribute("color_hovered", &this->color_hovered_);
-    this->AddAttribute("color_active",  &this->color_active_);
+    static const AttributeTable table = {
+        DescribeAttribute<ButtonStyle, &ButtonStyle::color_>(
+            atoms::kAttributeColor),
+        DescribeAttribute<ButtonStyle, &ButtonStyle::color_hovered_>(
+            atoms::kAttributeColorHovered),
+        DescribeAttribute<ButtonStyle, &ButtonStyle::color_active_>(
+            atoms::kAttributeColorActive)
+    };
+
+    return table;
 }
 
 void ButtonStyle::PushStyle()
@@ -48,7 +58,7 @@ bool ButtonStyle::OnProcessStart(std::string& error_message)
         return false;
     }
 
-    if (this->parent_->GetType() != "Button")
+    if (this->parent_->GetTypeAtom() != atoms::kButton)
     {
         error_message = "Object of type \"ButtonStyle\" can only be created "
                         "insdie an object of type \"Button\"";
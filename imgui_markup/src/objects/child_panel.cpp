@@ -4,18 +4,28 @@
 namespace imgui_markup
 {
 
-ChildPanel::ChildPanel(std::string id, Object* parent)
-    : Object("ChildPanel", id, parent)
+ChildPanel::ChildPanel(Atom id, Object* parent)
+    : Object(atoms::kChildPanel, id, parent)
+{ }
+
+const AttributeTable& ChildPanel::GetAttributeTable() const
 {
-    this->AddAttribute("size",   &this->size_);
-    this->AddAttribute("title",  &this->title_);
-    this->AddAttribute("border", &this->border_);
+    static const AttributeTable table = {
+        DescribeAttribute<ChildPanel, &ChildPanel::size_>(
+            atoms::kAttributeSize),
+        DescribeAttribute<ChildPanel, &ChildPanel::title_>(
+            atoms::kAttributeTitle),
+        DescribeAttribute<ChildPanel, &ChildPanel::border_>(
+            atoms::kAttributeBorder)
+    };
+
+    return table;
 }
 
 ChildPanel& ChildPanel::operator=(const ChildPanel& other)
 {
-    for (auto& child : this->child_objects_)
-        child->SetParent(other.parent_);
+    for (Object& child : this->GetChildren())
+        child.SetParent(other.parent_);
 
     return *this;
 }
@@ -29,17 +39,14 @@ void ChildPanel::Update()
 
     ImGui::BeginChild(this->title_, this->size_, this->border_.value);
 
-    for (auto& child : this->child_objects_)
+    for (Object& child : this->GetChildren())
     {
-        if (!child)
-            continue;
-
-        child->SetPosition(ImGui::GetCursorPos(), this->global_position_);
+        child.SetPosition(ImGui::GetCursorPos(), this->global_position_);
 
-        child->Update();
+        child.Update();
     }
 
-    this->is_hovered_ = ImGui::IsWindowHovered(ImGuiHoveredFlags_ChildWindows);
+    this->SetHovered(ImGui::IsWindowHovered(ImGuiHoveredFlags_ChildWindows));
     this->size_  = ImGui::GetWindowSize();
 
     ImGui::EndChild();
@@ -48,7 +55,7 @@ void ChildPanel::Update()
 bool ChildPanel::OnProcessEnd(std::string& error_message)
 {
     if (this->title_.value.empty())
-        this->title_ = this->id_.empty() ? "unknown" : this->id_;
+        this->title_ = this->id_.Empty() ? "unknown" : this->id_.String();
 
     return true;
 }
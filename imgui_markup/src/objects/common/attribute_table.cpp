@@ -0,0 +1,72 @@
+#include "impch.h"
+#include "imgui_markup/objects/common/attribute_table.h"
+
+namespace imgui_markup
+{
+
+AttributeTable::AttributeTable(
+    std::initializer_list<AttributeDescriptor> descriptors)
+    : AttributeTable(std::vector<AttributeDescriptor>(descriptors))
+{ }
+
+AttributeTable::AttributeTable(std::vector<AttributeDescriptor> descriptors)
+{
+    this->descriptors_.reserve(descriptors.size());
+
+    for (const AttributeDescriptor& descriptor : descriptors)
+    {
+        const bool exists = std::any_of(
+            this->descriptors_.begin(), this->descriptors_.end(),
+            [&](const AttributeDescriptor& other)
+            { return other.name == descriptor.name; });
+
+        if (exists)
+        {
+            internal::utils::Log("WARNING: Attribute \"" +
+                descriptor.name.String() +
+                "\" is already set in attribute table!");
+
+            continue;
+        }
+
+        this->descriptors_.push_back(descriptor);
+    }
+
+    // Smallest number of hash bits that can hold every name
+    uint32_t bits = 1;
+    while ((size_t(1) << bits) < this->descriptors_.size())
+        bits++;
+
+    // Multipliers are odd, so that every multiplier is a bijection of the
+    // atom IDs. If no multiplier is found, the table size is doubled.
+    constexpr uint32_t kAttempts = 1024;
+    for (;; bits++)
+    {
+        uint32_t multiplier = 0x9E3779B1u;
+        for (uint32_t i = 0; i < kAttempts; i++, multiplier += 2)
+        {
+            if (this->BuildSlots(multiplier, bits))
+                return;
+        }
+    }
+}
+
+bool AttributeTable::BuildSlots(uint32_t multiplier, uint32_t bits)
+{
+    this->multiplier_ = multiplier;
+    this->shift_      = 32 - bits;
+    this->slots_.assign(size_t(1) << bits, kEmptySlot);
+
+    for (uint32_t i = 0; i < this->descriptors_.size(); i++)
+    {
+        uint32_t& slot = this->slots_[this->Hash(this->descriptors_[i].name)];
+        if (slot != kEmptySlot)
+            return false;
+
+        slot = i;
+    }
+
+    return true;
+}
+
+}  // namespace imgui_markup
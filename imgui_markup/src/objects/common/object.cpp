@@ -4,71 +4,90 @@
 namespace imgui_markup
 {
 
-Object::Object(std::string name, std::string id, Object* parent)
+Object::Object(Atom name, Atom id, Object* parent)
     : type_(name), id_(id), parent_(parent)
 { }
 
-// Object& Object::operator=(const Object& other)
-// {
-//     for (auto& child : this->child_objects_)
-//         child->SetParent(other.parent_);
+Attribute* Object::GetAttribute(Atom name) const
+{
+    const AttributeDescriptor* descriptor =
+        this->GetAttributeTable().Find(name);
+
+    if (!descriptor)
+        return nullptr;
 
-//     return *this;
-// }
+    // The table only describes where the attribute is stored, the object
+    // itself is not changed by this function
+    return &descriptor->access(const_cast<Object&>(*this));
+}
 
-Attribute* Object::GetAttribute(const std::string name) const
+Attribute* Object::GetAttribute(std::string_view name) const
 {
-    if (this->attribute_list_.find(name) == this->attribute_list_.end())
+    Atom atom;
+    if (!Atom::Find(name, atom))
         return nullptr;
 
-    return this->attribute_list_.at(name);
+    return this->GetAttribute(atom);
 }
 
-void Object::SetPosition(Float2 draw_position, Float2 global_offset)
+void Object::SetPosition(const ImVec2& draw_position,
+                         const ImVec2& global_offset)
 {
-    this->draw_position_ = draw_position;
-    this->global_position_ = Float2(draw_position.x + global_offset.x,
-                                    draw_position.y + global_offset.y);
+    this->draw_position_.x = draw_position.x;
+    this->draw_position_.y = draw_position.y;
+
+    this->global_position_.x = draw_position.x + global_offset.x;
+    this->global_position_.y = draw_position.y + global_offset.y;
 
     if (!this->parent_)
         return;
 
-    const Float2 parent_position = this->parent_->GetDrawPosition();
+    const Float2& parent_position = this->parent_->GetDrawPosition();
 
-    this->relative_position_ = Float2(draw_position.x - parent_position.x,
-                                      draw_position.y - parent_position.y);
+    this->relative_position_.x = draw_position.x - parent_position.x;
+    this->relative_position_.y = draw_position.y - parent_position.y;
 }
 
-void Object::AddAttribute(const std::string name, Attribute* attribute)
+void Object::SetHovered(bool hovered)
 {
-    if (this->attribute_list_.find(name) != this->attribute_list_.end())
+    if (hovered != this->is_hovered_)
     {
-        internal::utils::Log("WARNING: Object \"" + this->type_ +
-            "\": Attribute \"" + name + "\" is already set in attribute list!");
+        this->PushEvent(hovered ? ObjectEventType::kHoverBegin
+                                : ObjectEventType::kHoverEnd);
+    }
 
+    this->is_hovered_ = hovered;
+
+    // Only hovered objects query the mouse buttons, so the cost does not
+    // depend on the number of objects
+    if (!hovered)
         return;
-    }
 
-    this->attribute_list_[name] = attribute;
+    for (ImGuiMouseButton button = 0; button < ImGuiMouseButton_COUNT;
+         button++)
+    {
+        if (ImGui::IsMouseClicked(button))
+            this->PushEvent(ObjectEventType::kClicked, button);
+    }
 }
 
-void Object::RemoveAttribute(const std::string name)
+void Object::PushEvent(ObjectEventType type, ImGuiMouseButton button)
 {
-    if (this->attribute_list_.find(name) == this->attribute_list_.end())
-    {
-        internal::utils::Log("WARNING: Object \"" + this->type_ +
-            "\": Attribute \"" + name +
-            "\" does not exists in the attribute list!");
-
+    if (!this->store_ || !this->store_->GetEventQueue())
         return;
-    }
 
-    this->attribute_list_.erase(name);
+    this->store_->GetEventQueue()->Push(*this, type, button);
+}
+
+const AttributeTable& Object::GetAttributeTable() const
+{
+    static const AttributeTable table = { };
+    return table;
 }
 
-void Object::AddChild(std::shared_ptr<Object> child)
+void Object::AddChild(Object& child)
 {
-    this->child_objects_.push_back(child);
+    this->store_->AddChild(*this, child);
 }
 
 }  // namespace imgui_markup
@@ -0,0 +1,31 @@
+#include "impch.h"
+#include "imgui_markup/objects/common/object_event.h"
+
+#include <utility>
+
+namespace imgui_markup
+{
+
+void ObjectEventQueue::Push(Object& object, ObjectEventType type,
+                            ImGuiMouseButton button)
+{
+    ObjectEvent& event = this->events_.emplace_back();
+    event.object.object_     = &object;
+    event.object.generation_ = this->generation_;
+    event.type   = type;
+    event.button = button;
+}
+
+void ObjectEventQueue::Swap(ObjectEventQueue& other) noexcept
+{
+    this->events_.swap(other.events_);
+    std::swap(this->generation_, other.generation_);
+}
+
+void ObjectEventQueue::Clear(uint64_t generation)
+{
+    this->events_.clear();
+    this->generation_ = generation;
+}
+
+}  // namespace imgui_markup
@@ -4,37 +4,39 @@
 namespace imgui_markup
 {
 
-std::shared_ptr<Object> ObjectList::CreateObject(
-    std::string type,
-    std::string id,
-    Object* parent)
+Object* ObjectList::CreateObject(
+    Atom type,
+    Atom id,
+    Object& parent)
 {
     return ObjectList::Get().IMPLCreateObject(type, id, parent);
 }
 
-bool ObjectList::IsDefined(std::string type)
+bool ObjectList::IsDefined(Atom type)
 {
     return ObjectList::Get().IMPLIsDefined(type);
 }
 
-ObjectList& ObjectList::Get()
+const ObjectList& ObjectList::Get()
 {
-    static ObjectList instance;
+    // Initialized once, even if multiple threads call the function
+    static const ObjectList instance;
     return instance;
 }
 
-std::shared_ptr<Object> ObjectList::IMPLCreateObject(
-    std::string type,
-    std::string id,
-    Object* parent)
+Object* ObjectList::IMPLCreateObject(
+    Atom type,
+    Atom id,
+    Object& parent) const
 {
-    if (this->IsDefined(type))
-        return this->object_list_.at(type)(id, parent);
+    const auto it = this->object_list_.find(type);
+    if (it == this->object_list_.end() || !parent.store_)
+        return nullptr;
 
-    return nullptr;
+    return &it->second(*parent.store_, id, parent);
 }
 
-bool ObjectList::IMPLIsDefined(std::string type)
+bool ObjectList::IMPLIsDefined(Atom type) const
 {
     if (this->object_list_.find(type) == this->object_list_.end())
         return false;
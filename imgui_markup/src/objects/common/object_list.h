@@ -17,9 +17,7 @@
 #include "imgui_markup/objects/attribute_types/object_int.h"
 #include "imgui_markup/objects/attribute_types/object_string.h"
 
-#include <memory>
-#include <map>
-#include <functional>
+#include <unordered_map>
 
 namespace imgui_markup
 {
@@ -35,24 +33,25 @@ public:
 
     // Functions
     /**
-     * Create a new object on the heap.
+     * Create a new object inside the object store of the parent object.
+     * The object is not added to the children of the parent.
      *
      * @param[in] type   - The type of the object that will be created.
      *                     Only types that are specified in the object_list_
-     *                     are allowed. An empty string is not allowed.
-     * @param[in] id     - The ID that the object will get. The string can be
+     *                     are allowed. An empty atom is not allowed.
+     * @param[in] id     - The ID that the object will get. The atom can be
      *                     empty if the object should not get an ID.
-     * @param[in] parent - A pointer to the parent object. It can be a nullptr,
-     *                     if the object has no parent obejct.
+     * @param[in] parent - The parent object, which has to be part of an
+     *                     object store, e.g. the global object.
      *
-     * @return A shared_ptr to the created object on the heap.
+     * @return A pointer to the created object, which is owned by the store.
      *         Nullptr will be returned if the object was not created because
      *         the given type does not exists in the object_list_.
     */
-    static std::shared_ptr<Object> CreateObject(
-        std::string type,
-        std::string id,
-        Object* parent);
+    static Object* CreateObject(
+        Atom type,
+        Atom id,
+        Object& parent);
 
     /**
      * Checks if the given type is defined in the object_list_.
@@ -60,7 +59,7 @@ public:
      * @return true if the type exists and an object with the type can be
      *         be created, false if there is no object of the given type.
     */
-    static bool IsDefined(std::string type);
+    static bool IsDefined(Atom type);
 
 private:
     // Constructor
@@ -70,42 +69,45 @@ private:
     /**
      * This is the main object_list_, containing the types and function
      * pointers to create an instance of an object.
+     * The list is never changed after it was created, so objects can be
+     * created from multiple threads at once.
     */
-    const std::map<std::string, std::function<std::shared_ptr<Object>(
-        std::string, Object*)>> object_list_ = {
-            { "Panel",       CreateObjectInstance<Panel>        },
-            { "ChildPanel",  CreateObjectInstance<ChildPanel>   },
-            { "Button",      CreateObjectInstance<Button>       },
-            { "ButtonStyle", CreateObjectInstance<ButtonStyle>  },
-            { "Text",        CreateObjectInstance<Text>         },
-            { "Container",   CreateObjectInstance<Container>    },
+    const std::unordered_map<Atom, Object& (*)(
+        ObjectStore&, Atom, Object&)> object_list_ = {
+            { atoms::kPanel,       CreateObjectInstance<Panel>        },
+            { atoms::kChildPanel,  CreateObjectInstance<ChildPanel>   },
+            { atoms::kButton,      CreateObjectInstance<Button>       },
+            { atoms::kButtonStyle, CreateObjectInstance<ButtonStyle>  },
+            { atoms::kText,        CreateObjectInstance<Text>         },
+            { atoms::kContainer,   CreateObjectInstance<Container>    },
 
             // Atribute types
-            { "Bool",        CreateObjectInstance<ObjectBool>   },
-            { "Float",       CreateObjectInstance<ObjectFloat>  },
-            { "Float2",      CreateObjectInstance<ObjectFloat2> },
-            { "Float3",      CreateObjectInstance<ObjectFloat3> },
-            { "Float4",      CreateObjectInstance<ObjectFloat4> },
-            { "Int",         CreateObjectInstance<ObjectInt>    },
-            { "String",      CreateObjectInstance<ObjectString> }
+            { atoms::kBool,        CreateObjectInstance<ObjectBool>   },
+            { atoms::kFloat,       CreateObjectInstance<ObjectFloat>  },
+            { atoms::kFloat2,      CreateObjectInstance<ObjectFloat2> },
+            { atoms::kFloat3,      CreateObjectInstance<ObjectFloat3> },
+            { atoms::kFloat4,      CreateObjectInstance<ObjectFloat4> },
+            { atoms::kInt,         CreateObjectInstance<ObjectInt>    },
+            { atoms::kString,      CreateObjectInstance<ObjectString> }
     };
 
     // Functions
-    static ObjectList& Get();
+    static const ObjectList& Get();
 
-    std::shared_ptr<Object> IMPLCreateObject(
-        std::string type,
-        std::string id,
-        Object* parent);
+    Object* IMPLCreateObject(
+        Atom type,
+        Atom id,
+        Object& parent) const;
 
-    bool IMPLIsDefined(std::string type);
+    bool IMPLIsDefined(Atom type) const;
 
     template<typename T>
-    static std::shared_ptr<T> CreateObjectInstance(
-        std::string id,
-        Object* parent)
+    static Object& CreateObjectInstance(
+        ObjectStore& store,
+        Atom id,
+        Object& parent)
     {
-        return std::make_shared<T>(id, parent);
+        return store.Create<T>(id, &parent);
     }
 };
 
@@ -0,0 +1,207 @@
+#include "impch.h"
+#include "imgui_markup/objects/common/object_references.h"
+
+namespace imgui_markup
+{
+
+ObjectReferences::ObjectReferences()
+    : child_pool_(internal::AllocateObject<internal::SlabPool, kSubsystem>(
+          kSubsystem)),
+      children_(internal::SlabAllocator<std::pair<const uint64_t, NodeIndex>>(
+          child_pool_.get()))
+{
+    this->nodes_.push_back({ kRoot, Atom(), nullptr });
+}
+
+ObjectReferences::ObjectReferences(ObjectReferences&& other)
+    : ObjectReferences()
+{
+    *this = std::move(other);
+}
+
+ObjectReferences& ObjectReferences::operator=(
+    ObjectReferences&& other) noexcept
+{
+    this->nodes_.swap(other.nodes_);
+    this->child_pool_.swap(other.child_pool_);
+    this->children_.swap(other.children_);
+    std::swap(this->size_, other.size_);
+
+    return *this;
+}
+
+bool ObjectReferences::Insert(NodeIndex scope, Atom id, Object& object,
+                              NodeIndex& dest)
+{
+    // Most IDs are a single segment, which is already interned
+    if (id.View().find('.') != std::string_view::npos)
+        return this->Insert(scope, id.View(), object, dest);
+
+    dest = this->AddChild(scope, id);
+
+    return this->SetObject(dest, object);
+}
+
+bool ObjectReferences::Insert(NodeIndex scope, std::string_view id,
+                              Object& object, NodeIndex& dest)
+{
+    dest = scope;
+
+    size_t start = 0;
+    while (true)
+    {
+        const size_t end = id.find('.', start);
+        dest = this->AddChild(dest, Atom(id.substr(start, end - start)));
+
+        if (end == id.npos)
+            break;
+
+        start = end + 1;
+    }
+
+    return this->SetObject(dest, object);
+}
+
+Object* ObjectReferences::Find(std::string_view full_id) const
+{
+    NodeIndex node = kRoot;
+
+    size_t start = 0;
+    while (true)
+    {
+        const size_t end = full_id.find('.', start);
+        if (!this->FindChild(node, full_id.substr(start, end - start), node))
+            return nullptr;
+
+        if (end == full_id.npos)
+            break;
+
+        start = end + 1;
+    }
+
+    return this->nodes_[node].object;
+}
+
+Object* ObjectReferences::FindLongestPrefix(std::string_view path,
+                                            size_t& length) const
+{
+    Object* object = nullptr;
+    length = 0;
+
+    NodeIndex node = kRoot;
+
+    size_t start = 0;
+    while (true)
+    {
+        const size_t end = path.find('.', start);
+        if (!this->FindChild(node, path.substr(start, end - start), node))
+            break;
+
+        // Objects are only resolved as long as every leading part of the
+        // path is an object
+        Object* segment_object = this->nodes_[node].object;
+        if (!segment_object)
+            break;
+
+        object = segment_object;
+        length = end == path.npos ? path.size() : end;
+
+        if (end == path.npos)
+            break;
+
+        start = end + 1;
+    }
+
+    return object;
+}
+
+std::string ObjectReferences::GetFullID(NodeIndex node) const
+{
+    std::vector<std::string_view> segments;
+    size_t size = 0;
+
+    for (; node != kRoot; node = this->nodes_[node].parent)
+    {
+        segments.push_back(this->nodes_[node].segment.View());
+        size += segments.back().size() + 1;
+    }
+
+    std::string full_id;
+    full_id.reserve(size);
+
+    for (auto it = segments.rbegin(); it != segments.rend(); it++)
+    {
+        if (it != segments.rbegin())
+            full_id += '.';
+
+        full_id += *it;
+    }
+
+    return full_id;
+}
+
+void ObjectReferences::ForEach(const std::function<
+    void(const std::string& full_id, Object& object)>& function) const
+{
+    for (NodeIndex i = 0; i < this->nodes_.size(); i++)
+    {
+        if (this->nodes_[i].object)
+            function(this->GetFullID(i), *this->nodes_[i].object);
+    }
+}
+
+void ObjectReferences::Clear()
+{
+    this->nodes_.resize(1);
+    this->children_.clear();
+    this->size_ = 0;
+}
+
+void ObjectReferences::Reserve(size_t count)
+{
+    this->nodes_.reserve(count + 1);
+    this->children_.reserve(count);
+}
+
+ObjectReferences::NodeIndex ObjectReferences::AddChild(NodeIndex parent,
+                                                       Atom segment)
+{
+    const auto [it, inserted] = this->children_.emplace(
+        ChildKey(parent, segment),
+        static_cast<NodeIndex>(this->nodes_.size()));
+
+    if (inserted)
+        this->nodes_.push_back({ parent, segment, nullptr });
+
+    return it->second;
+}
+
+bool ObjectReferences::FindChild(NodeIndex parent, std::string_view segment,
+                                 NodeIndex& dest) const
+{
+    // Segments that were never interned can not be inside the index
+    Atom atom;
+    if (!Atom::Find(segment, atom))
+        return false;
+
+    const auto it = this->children_.find(ChildKey(parent, atom));
+    if (it == this->children_.end())
+        return false;
+
+    dest = it->second;
+    return true;
+}
+
+bool ObjectReferences::SetObject(NodeIndex node, Object& object)
+{
+    Node& entry = this->nodes_[node];
+    if (entry.object)
+        return false;
+
+    entry.object = &object;
+    this->size_++;
+
+    return true;
+}
+
+}  // namespace imgui_markup
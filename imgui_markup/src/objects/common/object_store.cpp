@@ -0,0 +1,107 @@
+#include "impch.h"
+#include "imgui_markup/objects/common/object_store.h"
+
+#include "imgui_markup/objects/common/object.h"
+
+#include <atomic>
+
+namespace imgui_markup
+{
+
+ObjectStore::ObjectStore(Object& root, ObjectEventQueue* events)
+    : events_(events)
+{
+    this->Register(root);
+}
+
+void ObjectStore::AddChild(Object& parent, Object& child)
+{
+    const Index parent_index = parent.store_index_;
+    const Index child_index  = child.store_index_;
+
+    if (this->first_child_[parent_index] == kNone)
+        this->first_child_[parent_index] = child_index;
+    else
+        this->next_sibling_[this->last_child_[parent_index]] = child_index;
+
+    this->last_child_[parent_index] = child_index;
+}
+
+void ObjectStore::Swap(ObjectStore& other) noexcept
+{
+    Object* const root       = this->objects_[kRoot];
+    Object* const other_root = other.objects_[kRoot];
+
+    this->objects_.swap(other.objects_);
+    this->first_child_.swap(other.first_child_);
+    this->last_child_.swap(other.last_child_);
+    this->next_sibling_.swap(other.next_sibling_);
+    this->pools_.swap(other.pools_);
+
+    this->objects_[kRoot]  = root;
+    other.objects_[kRoot]  = other_root;
+
+    this->AdoptObjects(other_root);
+    other.AdoptObjects(root);
+}
+
+void ObjectStore::Clear()
+{
+    for (Pool& pool : this->pools_)
+    {
+        if (pool)
+            pool->Clear();
+    }
+
+    this->objects_.resize(1);
+    this->first_child_.assign(1, kNone);
+    this->last_child_.assign(1, kNone);
+    this->next_sibling_.assign(1, kNone);
+}
+
+void ObjectStore::ReleaseMemory()
+{
+    for (Pool& pool : this->pools_)
+    {
+        if (pool)
+            pool->ReleaseMemory();
+    }
+
+    this->objects_.shrink_to_fit();
+    this->first_child_.shrink_to_fit();
+    this->last_child_.shrink_to_fit();
+    this->next_sibling_.shrink_to_fit();
+}
+
+void ObjectStore::Register(Object& object)
+{
+    object.store_       = this;
+    object.store_index_ = static_cast<Index>(this->objects_.size());
+
+    this->objects_.push_back(&object);
+    this->first_child_.push_back(kNone);
+    this->last_child_.push_back(kNone);
+    this->next_sibling_.push_back(kNone);
+}
+
+void ObjectStore::AdoptObjects(const Object* previous_root) noexcept
+{
+    Object* const root = this->objects_[kRoot];
+
+    for (size_t i = kRoot + 1; i < this->objects_.size(); i++)
+    {
+        Object& object = *this->objects_[i];
+        object.store_ = this;
+
+        if (object.parent_ == previous_root)
+            object.parent_ = root;
+    }
+}
+
+size_t ObjectStore::NextPoolIndex()
+{
+    static std::atomic<size_t> next_index = 0;
+    return next_index++;
+}
+
+}  // namespace imgui_markup
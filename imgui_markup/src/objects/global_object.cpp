@@ -3,36 +3,77 @@
 
 #include "objects/common/object_list.h"
 
+#include <atomic>
+#include <utility>
+
 namespace imgui_markup
 {
 
+namespace
+{
+
+uint64_t NextGeneration()
+{
+    static std::atomic<uint64_t> generation = 0;
+    return ++generation;
+}
+
+}  // namespace
+
 GlobalObject::GlobalObject()
-    : Object("GlobalObject", "global", nullptr)
+    : Object(atoms::kGlobalObject, atoms::kGlobal, nullptr),
+      object_store_(*this, &events_),
+      generation_(NextGeneration())
+{
+    this->events_.Clear(this->generation_);
+}
+
+GlobalObject::GlobalObject(GlobalObject&& other)
+    : GlobalObject()
+{
+    this->Swap(other);
+}
+
+GlobalObject& GlobalObject::operator=(GlobalObject&& other) noexcept
+{
+    if (this != &other)
+        this->Swap(other);
+
+    return *this;
+}
+
+const AttributeTable& GlobalObject::GetAttributeTable() const
 {
-    this->AddAttribute("id",          &this->id_);
-    this->AddAttribute("version",     &this->version_);
-    this->AddAttribute("description", &this->description_);
-    this->AddAttribute("author",      &this->author_);
-    this->AddAttribute("date",        &this->date_);
+    static const AttributeTable table = {
+        DescribeAttribute<GlobalObject, &GlobalObject::id_>(
+            atoms::kAttributeID),
+        DescribeAttribute<GlobalObject, &GlobalObject::version_>(
+            atoms::kAttributeVersion),
+        DescribeAttribute<GlobalObject, &GlobalObject::description_>(
+            atoms::kAttributeDescription),
+        DescribeAttribute<GlobalObject, &GlobalObject::author_>(
+            atoms::kAttributeAuthor),
+        DescribeAttribute<GlobalObject, &GlobalObject::date_>(
+            atoms::kAttributeDate)
+    };
+
+    return table;
 }
 
 GlobalObject& GlobalObject::operator=(const GlobalObject& other)
 {
-    for (auto& child : this->child_objects_)
-        child->SetParent(other.parent_);
+    for (Object& child : this->GetChildren())
+        child.SetParent(other.parent_);
 
     return *this;
 }
 
 void GlobalObject::Update()
 {
-    for (auto& child : this->child_objects_)
-    {
-        if (!child)
-            continue;
+    this->events_.Clear(this->generation_);
 
-        child->Update();
-    }
+    for (Object& child : this->GetChildren())
+        child.Update();
 }
 
 void GlobalObject::Reset()
@@ -41,21 +82,30 @@ void GlobalObject::Reset()
     this->description_.value.clear();
     this->author_.value.clear();
 
-    this->child_objects_.clear();
+    this->object_references_.Clear();
+    this->object_store_.Clear();
+
+    this->generation_ = NextGeneration();
+    this->events_.Clear(this->generation_);
+}
+
+void GlobalObject::ReleaseMemory()
+{
+    this->object_store_.ReleaseMemory();
 }
 
 bool GlobalObject::IsHovered() const noexcept
 {
-    for (const auto& child : this->child_objects_)
+    for (const Object& child : this->GetChildren())
     {
-        if (this->IsHovered(*child.get()))
+        if (this->IsHovered(child))
             return true;
     }
 
     return false;
 }
 
-bool GlobalObject::IsHovered(std::string object_id) const noexcept
+bool GlobalObject::IsHovered(std::string_view object_id) const noexcept
 {
     Object* object = this->GetObjectReference(object_id);
     if (!object)
@@ -64,11 +114,19 @@ bool GlobalObject::IsHovered(std::string object_id) const noexcept
     return this->IsHovered(*object);
 }
 
+bool GlobalObject::IsHovered(const ObjectHandle& handle) const noexcept
+{
+    if (!this->IsValid(handle))
+        return false;
+
+    return this->IsHovered(*handle.object_);
+}
+
 bool GlobalObject::IsPressed(ImGuiMouseButton button) const noexcept
 {
-    for (const auto& child : this->child_objects_)
+    for (const Object& child : this->GetChildren())
     {
-        if (this->IsHovered(*child.get()) && ImGui::IsMouseClicked(button))
+        if (this->IsHovered(child) && ImGui::IsMouseClicked(button))
             return true;
     }
 
@@ -76,7 +134,7 @@ bool GlobalObject::IsPressed(ImGuiMouseButton button) const noexcept
 }
 
 bool GlobalObject::IsPressed(
-    std::string object_id, ImGuiMouseButton button) const noexcept
+    std::string_view object_id, ImGuiMouseButton button) const noexcept
 {
     Object* object = this->GetObjectReference(object_id);
     if (!object)
@@ -85,15 +143,58 @@ bool GlobalObject::IsPressed(
     return this->IsHovered(*object) && ImGui::IsMouseClicked(button);
 }
 
-Object* GlobalObject::GetObjectReference(std::string object_id) const noexcept
+bool GlobalObject::IsPressed(
+    const ObjectHandle& handle, ImGuiMouseButton button) const noexcept
 {
-    if (this->object_references_.find(object_id) ==
-        this->object_references_.end())
-    {
-        return nullptr;
-    }
+    if (!this->IsValid(handle))
+        return false;
+
+    return this->IsHovered(*handle.object_) && ImGui::IsMouseClicked(button);
+}
+
+ObjectHandle GlobalObject::GetObjectHandle(
+    std::string_view object_id) const noexcept
+{
+    ObjectHandle handle;
+    handle.object_ = this->GetObjectReference(object_id);
+    handle.generation_ = this->generation_;
+
+    return handle;
+}
+
+AttributeHandle GlobalObject::GetAttributeHandle(
+    std::string_view attribute_path) const noexcept
+{
+    AttributeHandle handle;
+
+    size_t object_id_size;
+    Object* object = this->object_references_.FindLongestPrefix(
+        attribute_path, object_id_size);
+
+    if (!object || object_id_size >= attribute_path.size())
+        return handle;
+
+    attribute_path.remove_prefix(object_id_size + 1);
+
+    handle.attribute_ = object->GetAttribute(attribute_path);
+    handle.generation_ = this->generation_;
 
-    return &this->object_references_.at(object_id);
+    return handle;
+}
+
+bool GlobalObject::Set(const AttributeHandle& handle,
+                       const AttributeValue& value)
+{
+    if (!this->IsValid(handle))
+        return false;
+
+    return handle.attribute_->LoadValue(value);
+}
+
+Object* GlobalObject::GetObjectReference(
+    std::string_view object_id) const noexcept
+{
+    return this->object_references_.Find(object_id);
 }
 
 bool GlobalObject::IsHovered(const Object& object) const noexcept
@@ -101,4 +202,21 @@ bool GlobalObject::IsHovered(const Object& object) const noexcept
     return object.IsHovered();
 }
 
+void GlobalObject::Swap(GlobalObject& other) noexcept
+{
+    std::swap(this->id_, other.id_);
+    std::swap(this->version_, other.version_);
+    std::swap(this->description_, other.description_);
+    std::swap(this->author_, other.author_);
+    std::swap(this->date_, other.date_);
+
+    // Moving the references swaps them, see ObjectReferences
+    this->object_references_ = std::move(other.object_references_);
+
+    this->events_.Swap(other.events_);
+    this->object_store_.Swap(other.object_store_);
+
+    std::swap(this->generation_, other.generation_);
+}
+
 }  // namespace imgui_markup
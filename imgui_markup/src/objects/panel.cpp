@@ -4,18 +4,28 @@
 namespace imgui_markup
 {
 
-Panel::Panel(std::string id, Object* parent)
-    : Object("Panel", id, parent)
+Panel::Panel(Atom id, Object* parent)
+    : Object(atoms::kPanel, id, parent)
+{ }
+
+const AttributeTable& Panel::GetAttributeTable() const
 {
-    this->AddAttribute("title", &this->title_);
-    this->AddAttribute("position", &this->global_position_);
-    this->AddAttribute("size", &this->size_);
+    static const AttributeTable table = {
+        DescribeAttribute<Panel, &Panel::title_>(
+            atoms::kAttributeTitle),
+        DescribeAttribute<Panel, &Panel::global_position_>(
+            atoms::kAttributePosition),
+        DescribeAttribute<Panel, &Panel::size_>(
+            atoms::kAttributeSize)
+    };
+
+    return table;
 }
 
 Panel& Panel::operator=(const Panel& other)
 {
-    for (auto& child : this->child_objects_)
-        child->SetParent(other.parent_);
+    for (Object& child : this->GetChildren())
+        child.SetParent(other.parent_);
 
     return *this;
 }
@@ -28,23 +38,20 @@ void Panel::Update()
     if (!ImGui::Begin(this->title_))
     {
         ImGui::End();
-        this->is_hovered_ = false;
+        this->SetHovered(false);
         this->size_ = Float2();
         return;
     }
 
-    this->is_hovered_ =
-        ImGui::IsWindowHovered(ImGuiHoveredFlags_ChildWindows);
+    this->SetHovered(
+        ImGui::IsWindowHovered(ImGuiHoveredFlags_ChildWindows));
     this->size_ = ImGui::GetWindowSize();
     this->global_position_ = ImGui::GetWindowPos();
 
-    for (auto& child : this->child_objects_)
+    for (Object& child : this->GetChildren())
     {
-        if (!child)
-            continue;
-
-        child->SetPosition(ImGui::GetCursorPos(), this->global_position_);
-        child->Update();
+        child.SetPosition(ImGui::GetCursorPos(), this->global_position_);
+        child.Update();
     }
 
     ImGui::End();
@@ -65,7 +72,7 @@ bool Panel::Validate(std::string& error_message) const
     if (!this->parent_)
         return true;
 
-    if (this->parent_->GetType() == "GlobalObject")
+    if (this->parent_->GetTypeAtom() == atoms::kGlobalObject)
         return true;
 
     error_message = "Object of type \"Panel\" can only be created inside the "
@@ -77,7 +84,7 @@ bool Panel::Validate(std::string& error_message) const
 bool Panel::OnProcessEnd(std::string& error_message)
 {
     if (this->title_.value.empty())
-        this->title_ = this->id_.empty() ? "unknown" : this->id_;
+        this->title_ = this->id_.Empty() ? "unknown" : this->id_.String();
 
     return true;
 }
@@ -4,17 +4,24 @@
 namespace imgui_markup
 {
 
-Text::Text(std::string id, Object* parent)
-    : Object("Text", id, parent)
+Text::Text(Atom id, Object* parent)
+    : Object(atoms::kText, id, parent)
+{ }
+
+const AttributeTable& Text::GetAttributeTable() const
 {
-    this->AddAttribute("text", &this->text_);
-    this->AddAttribute("color", &this->color_);
+    static const AttributeTable table = {
+        DescribeAttribute<Text, &Text::text_>(atoms::kAttributeText),
+        DescribeAttribute<Text, &Text::color_>(atoms::kAttributeColor)
+    };
+
+    return table;
 }
 
 Text& Text::operator=(const Text& other)
 {
-    for (auto& child : this->child_objects_)
-        child->SetParent(other.parent_);
+    for (Object& child : this->GetChildren())
+        child.SetParent(other.parent_);
 
     return *this;
 }
@@ -23,12 +30,22 @@ void Text::Update()
 {
     ImGui::SetCursorPos(this->draw_position_);
 
+    // The unformatted version does not run the text through the printf
+    // formatter, and the end of the text is known, so it is not measured
+    const std::string& text = this->text_.value;
+
     if (this->color_.value_changed_)
-        ImGui::TextColored(this->color_, "%s", this->text_.value.c_str());
+    {
+        ImGui::PushStyleColor(ImGuiCol_Text, this->color_);
+        ImGui::TextUnformatted(text.data(), text.data() + text.size());
+        ImGui::PopStyleColor();
+    }
     else
-        ImGui::Text("%s", this->text_.value.c_str());
+    {
+        ImGui::TextUnformatted(text.data(), text.data() + text.size());
+    }
 
-    this->is_hovered_ = ImGui::IsItemHovered();
+    this->SetHovered(ImGui::IsItemHovered());
     this->size_ = ImGui::GetItemRectSize();
 }
 
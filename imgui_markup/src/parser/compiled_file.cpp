@@ -0,0 +1,646 @@
+#include "impch.h"
+#include "parser/compiled_file.h"
+
+#include "objects/common/object_list.h"
+#include "imgui_markup/attribute_types/bool.h"
+#include "imgui_markup/attribute_types/float.h"
+#include "imgui_markup/attribute_types/float2.h"
+#include "imgui_markup/attribute_types/float3.h"
+#include "imgui_markup/attribute_types/float4.h"
+#include "imgui_markup/attribute_types/int.h"
+#include "imgui_markup/attribute_types/string.h"
+
+#include <cstring>
+#include <limits>
+
+namespace imgui_markup::internal::parser
+{
+
+using namespace compiled_file;
+
+namespace
+{
+
+/**
+ * Checks that a section of count records of type T lies inside the file
+ * and is aligned, so that the records can be accessed in place.
+ */
+template<typename T>
+const T* GetSection(const SourceBuffer& buffer, uint32_t offset,
+                    uint32_t count, const char* name)
+{
+    const uint64_t end = static_cast<uint64_t>(offset) +
+                         static_cast<uint64_t>(count) * sizeof(T);
+
+    if (end > buffer.Size())
+        throw InvalidCompiledFile(std::string(name) + " out of range");
+
+    const char* data = buffer.Begin() + offset;
+    if (reinterpret_cast<uintptr_t>(data) % alignof(T) != 0)
+        throw InvalidCompiledFile(std::string(name) + " not aligned");
+
+    return reinterpret_cast<const T*>(data);
+}
+
+}  // namespace
+
+/* CompiledFile */
+ParserResult CompiledFile::Write(
+    const GlobalObject& source, const std::string& path,
+    const std::vector<CompiledSource>& sources)
+{
+    this->Reset();
+
+    ParserResult result(ParserResultType::kSuccess);
+
+    try
+    {
+        this->WriteObject(source, kNone);
+        this->WriteReferences(source);
+
+        // String values are stored after the names, so that only the
+        // names have to be interned when the file is loaded
+        const uint32_t name_count =
+            static_cast<uint32_t>(this->strings_.size());
+
+        for (auto& attribute : this->attributes_)
+        {
+            if (attribute.type ==
+                static_cast<uint32_t>(AttributeType::kString))
+            {
+                attribute.string_value += name_count;
+            }
+        }
+
+        for (const std::string* value : this->string_values_)
+            this->AddString(*value);
+
+        const uint32_t reference_offset =
+            static_cast<uint32_t>(this->strings_.size());
+
+        for (auto& reference : this->references_)
+            reference.id += reference_offset;
+
+        for (const std::string& full_id : this->reference_ids_)
+            this->AddString(full_id);
+
+        for (const auto& file : sources)
+        {
+            SourceRecord record;
+            record.hash    = file.hash;
+            record.size    = file.size;
+            record.path    = this->AddString(file.path);
+            record.padding = 0;
+
+            this->sources_.push_back(record);
+        }
+
+        this->WriteFile(path);
+    }
+    catch (const CompiledFileException& e)
+    {
+        result = ParserResult(e.type, e.message,
+                              ParserPosition({ path }, "", 0, 0, 0));
+    }
+
+    this->Reset();
+
+    return result;
+}
+
+ParserResult CompiledFile::Load(
+    const std::string& path, GlobalObject& dest,
+    const std::function<bool(const std::vector<CompiledSource>&)>&
+        check_sources)
+{
+    this->Reset();
+
+    ParserResult result(ParserResultType::kSuccess);
+
+    try
+    {
+        dest.Reset();
+
+        this->OpenFile(path);
+
+        if (check_sources && !check_sources(this->GetSources()))
+            throw CompiledFileOutdated();
+
+        // Every name is interned once, objects and attributes only use
+        // the atoms afterwards
+        this->name_atoms_.reserve(this->header_->name_count);
+        for (uint32_t i = 0; i < this->header_->name_count; i++)
+            this->name_atoms_.emplace_back(this->GetString(i));
+
+        if (this->objects_in_[0].type != atoms::kGlobalObject ||
+            this->objects_in_[0].parent != kNone)
+        {
+            throw InvalidCompiledFile(
+                "first object is not the global object");
+        }
+
+        this->loaded_objects_.resize(this->header_->object_count, nullptr);
+        this->loaded_objects_[0] = &dest;
+
+        this->LoadObject(0, dest);
+        this->LoadReferences(dest);
+    }
+    catch (const CompiledFileException& e)
+    {
+        dest.Reset();
+
+        result = ParserResult(e.type, e.message,
+                              ParserPosition({ path }, "", 0, 0, 0));
+    }
+    catch (const AtomTableFull& e)
+    {
+        dest.Reset();
+
+        result = ParserResult(ParserResultType::kTooManyNames, e.what(),
+                              ParserPosition({ path }, "", 0, 0, 0));
+    }
+
+    this->Reset();
+
+    return result;
+}
+
+void CompiledFile::Reset()
+{
+    this->strings_.clear();
+    this->objects_.clear();
+    this->attributes_.clear();
+    this->references_.clear();
+    this->sources_.clear();
+    this->string_data_.clear();
+    this->names_.clear();
+    this->object_indices_.clear();
+    this->string_values_.clear();
+    this->reference_ids_.clear();
+
+    this->buffer_.Close();
+    this->header_         = nullptr;
+    this->sources_in_     = nullptr;
+    this->strings_in_     = nullptr;
+    this->objects_in_     = nullptr;
+    this->attributes_in_  = nullptr;
+    this->string_data_in_ = nullptr;
+    this->name_atoms_.clear();
+    this->loaded_objects_.clear();
+}
+
+uint32_t CompiledFile::AddName(Atom name)
+{
+    const auto it = this->names_.find(name);
+    if (it != this->names_.end())
+        return it->second;
+
+    const uint32_t index = this->AddString(name.View());
+    this->names_.insert({ name, index });
+
+    return index;
+}
+
+uint32_t CompiledFile::AddString(std::string_view value)
+{
+    const uint32_t index = static_cast<uint32_t>(this->strings_.size());
+
+    this->strings_.push_back({
+        static_cast<uint32_t>(this->string_data_.size()),
+        static_cast<uint32_t>(value.size()) });
+
+    this->string_data_ += value;
+
+    return index;
+}
+
+void CompiledFile::WriteObject(const Object& object, uint32_t parent)
+{
+    const uint32_t index = static_cast<uint32_t>(this->objects_.size());
+    this->object_indices_.insert({ &object, index });
+
+    ObjectRecord record;
+    record.type            = object.GetTypeAtom().GetID();
+    record.id              = this->AddName(object.GetIDAtom());
+    record.parent          = parent;
+    record.first_child     = kNone;
+    record.next_sibling    = kNone;
+    record.first_attribute = static_cast<uint32_t>(this->attributes_.size());
+
+    // Only attributes that were set by the markup are stored, every other
+    // attribute keeps the default value of the object
+    for (const AttributeDescriptor& descriptor : object.GetAttributeTable())
+    {
+        const Attribute* attribute = object.GetAttribute(descriptor.name);
+        if (attribute->value_changed_)
+            this->WriteAttribute(descriptor.name, *attribute);
+    }
+
+    record.attribute_count = static_cast<uint32_t>(
+        this->attributes_.size() - record.first_attribute);
+
+    this->objects_.push_back(record);
+
+    uint32_t previous = kNone;
+    for (const Object& child : object.GetChildren())
+    {
+        const uint32_t child_index =
+            static_cast<uint32_t>(this->objects_.size());
+
+        this->WriteObject(child, index);
+
+        if (previous == kNone)
+            this->objects_[index].first_child = child_index;
+        else
+            this->objects_[previous].next_sibling = child_index;
+
+        previous = child_index;
+    }
+}
+
+void CompiledFile::WriteAttribute(Atom name, const Attribute& attribute)
+{
+    AttributeRecord record;
+    std::memset(&record, 0, sizeof(record));
+
+    record.name = this->AddName(name);
+    record.type = static_cast<uint32_t>(attribute.type);
+
+    switch (attribute.type)
+    {
+    case AttributeType::kBool:
+        record.bool_value = static_cast<const Bool&>(attribute).value;
+        break;
+    case AttributeType::kFloat:
+        record.float_value[0] = static_cast<const Float&>(attribute).value;
+        break;
+    case AttributeType::kFloat2:
+    {
+        const Float2& value = static_cast<const Float2&>(attribute);
+        record.float_value[0] = value.x;
+        record.float_value[1] = value.y;
+        break;
+    }
+    case AttributeType::kFloat3:
+    {
+        const Float3& value = static_cast<const Float3&>(attribute);
+        record.float_value[0] = value.x;
+        record.float_value[1] = value.y;
+        record.float_value[2] = value.z;
+        break;
+    }
+    case AttributeType::kFloat4:
+    {
+        const Float4& value = static_cast<const Float4&>(attribute);
+        record.float_value[0] = value.x;
+        record.float_value[1] = value.y;
+        record.float_value[2] = value.z;
+        record.float_value[3] = value.w;
+        break;
+    }
+    case AttributeType::kInt:
+        record.int_value = static_cast<const Int&>(attribute).value;
+        break;
+    case AttributeType::kString:
+        // Converted to a string index after every name was added
+        record.string_value =
+            static_cast<uint32_t>(this->string_values_.size());
+        this->string_values_.push_back(
+            &static_cast<const String&>(attribute).value);
+        break;
+    }
+
+    this->attributes_.push_back(record);
+}
+
+void CompiledFile::WriteReferences(const GlobalObject& source)
+{
+    source.object_references_.ForEach(
+        [this](const std::string& full_id, const Object& object)
+        {
+            const auto it = this->object_indices_.find(&object);
+            if (it == this->object_indices_.end())
+                return;
+
+            // The full ID is added to the string table by Write
+            this->references_.push_back({
+                static_cast<uint32_t>(this->reference_ids_.size()),
+                it->second });
+            this->reference_ids_.push_back(full_id);
+        });
+
+    // Keeps the output independent of the order of the hash map
+    std::sort(this->references_.begin(), this->references_.end(),
+        [](const ReferenceRecord& left, const ReferenceRecord& right)
+        { return left.object < right.object; });
+}
+
+void CompiledFile::WriteFile(const std::string& path) const
+{
+    Header header;
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.byte_order       = kByteOrder;
+    header.version          = kVersion;
+    header.string_count     = static_cast<uint32_t>(this->strings_.size());
+    header.name_count       = static_cast<uint32_t>(this->names_.size());
+    header.object_count     = static_cast<uint32_t>(this->objects_.size());
+    header.attribute_count  = static_cast<uint32_t>(this->attributes_.size());
+    header.reference_count  = static_cast<uint32_t>(this->references_.size());
+    header.source_count     = static_cast<uint32_t>(this->sources_.size());
+    header.string_data_size = static_cast<uint32_t>(this->string_data_.size());
+
+    // The source records are the only records with 8 byte members,
+    // every other record only contains 4 byte members. So the sections
+    // are aligned without any padding, if the sources are stored first.
+    static_assert(sizeof(Header) % alignof(SourceRecord) == 0);
+
+    uint64_t offset = sizeof(Header);
+
+    const auto add_section = [&offset](uint32_t& dest, uint64_t size)
+    {
+        dest = static_cast<uint32_t>(offset);
+        offset += size;
+    };
+
+    add_section(header.sources_offset,
+                this->sources_.size() * sizeof(SourceRecord));
+    add_section(header.strings_offset,
+                this->strings_.size() * sizeof(StringRecord));
+    add_section(header.objects_offset,
+                this->objects_.size() * sizeof(ObjectRecord));
+    add_section(header.attributes_offset,
+                this->attributes_.size() * sizeof(AttributeRecord));
+    add_section(header.references_offset,
+                this->references_.size() * sizeof(ReferenceRecord));
+    add_section(header.string_data_offset, this->string_data_.size());
+
+    if (offset > std::numeric_limits<uint32_t>::max())
+    {
+        throw CompiledFileException("Object tree is too large to be compiled",
+                                    ParserResultType::kUnableToWriteFile);
+    }
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+    {
+        throw CompiledFileException("Unable to open file \"" + path + "\"",
+                                    ParserResultType::kUnableToWriteFile);
+    }
+
+    const auto write = [&file](const void* data, size_t size)
+    {
+        file.write(static_cast<const char*>(data), size);
+    };
+
+    write(&header, sizeof(header));
+    write(this->sources_.data(), this->sources_.size() * sizeof(SourceRecord));
+    write(this->strings_.data(), this->strings_.size() * sizeof(StringRecord));
+    write(this->objects_.data(), this->objects_.size() * sizeof(ObjectRecord));
+    write(this->attributes_.data(),
+          this->attributes_.size() * sizeof(AttributeRecord));
+    write(this->references_.data(),
+          this->references_.size() * sizeof(ReferenceRecord));
+    write(this->string_data_.data(), this->string_data_.size());
+
+    if (!file)
+    {
+        throw CompiledFileException("Unable to write file \"" + path + "\"",
+                                    ParserResultType::kUnableToWriteFile);
+    }
+}
+
+void CompiledFile::OpenFile(const std::string& path)
+{
+    if (!this->buffer_.Open(path))
+    {
+        throw CompiledFileException("Unable to open file \"" + path + "\"",
+                                    ParserResultType::kUnableToOpenFile);
+    }
+
+    this->header_ = GetSection<Header>(this->buffer_, 0, 1, "header");
+
+    const Header& header = *this->header_;
+
+    if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0)
+        throw InvalidCompiledFile("not a compiled markup file");
+    if (header.byte_order != kByteOrder)
+        throw InvalidCompiledFile("compiled on a machine with a different "
+                                  "byte order");
+    if (header.version != kVersion)
+        throw InvalidCompiledFile("compiled with a different version");
+
+    if (header.name_count > header.string_count)
+        throw InvalidCompiledFile("name count out of range");
+    if (header.object_count == 0)
+        throw InvalidCompiledFile("missing global object");
+
+    this->sources_in_ = GetSection<SourceRecord>(this->buffer_,
+        header.sources_offset, header.source_count, "sources");
+    this->strings_in_ = GetSection<StringRecord>(this->buffer_,
+        header.strings_offset, header.string_count, "string table");
+    this->objects_in_ = GetSection<ObjectRecord>(this->buffer_,
+        header.objects_offset, header.object_count, "objects");
+    this->attributes_in_ = GetSection<AttributeRecord>(this->buffer_,
+        header.attributes_offset, header.attribute_count, "attributes");
+    this->string_data_in_ = GetSection<char>(this->buffer_,
+        header.string_data_offset, header.string_data_size, "string data");
+
+    GetSection<ReferenceRecord>(this->buffer_, header.references_offset,
+                                header.reference_count, "references");
+}
+
+void CompiledFile::LoadObject(uint32_t index, Object& object)
+{
+    const ObjectRecord& record = this->objects_in_[index];
+
+    if (record.first_attribute > this->header_->attribute_count ||
+        record.attribute_count >
+            this->header_->attribute_count - record.first_attribute)
+    {
+        throw InvalidCompiledFile("attribute index out of range");
+    }
+
+    for (uint32_t i = 0; i < record.attribute_count; i++)
+    {
+        this->LoadAttribute(
+            this->attributes_in_[record.first_attribute + i], object);
+    }
+
+    // Children are stored after their parent and siblings are stored in
+    // ascending order, which also makes sure that the chain ends
+    uint32_t previous = index;
+    for (uint32_t child = record.first_child; child != kNone;
+         child = this->objects_in_[child].next_sibling)
+    {
+        if (child <= previous || child >= this->header_->object_count)
+            throw InvalidCompiledFile("object index out of range");
+        if (this->objects_in_[child].parent != index)
+            throw InvalidCompiledFile("wrong parent object");
+
+        this->LoadChildObject(child, object);
+
+        previous = child;
+    }
+}
+
+void CompiledFile::LoadChildObject(uint32_t index, Object& parent)
+{
+    const ObjectRecord& record = this->objects_in_[index];
+
+    // Type codes are builtin atoms, so they do not have to be interned
+    if (record.type >= atoms::kBuiltinCount)
+        throw InvalidCompiledFile("undefined object type");
+
+    Object* object = ObjectList::CreateObject(
+        static_cast<atoms::Builtin>(record.type), this->GetName(record.id),
+        parent);
+
+    if (!object)
+        throw InvalidCompiledFile("undefined object type");
+
+    std::string error_message;
+    if (!object->Validate(error_message))
+    {
+        throw CompiledFileException(error_message,
+                                    ParserResultType::kObjectIsNotValid);
+    }
+
+    parent.AddChild(*object);
+    this->loaded_objects_[index] = object;
+
+    if (!object->OnProcessStart(error_message))
+    {
+        throw CompiledFileException(error_message,
+                                    ParserResultType::kObjectIsNotValid);
+    }
+
+    this->LoadObject(index, *object);
+
+    if (!object->OnProcessEnd(error_message))
+    {
+        throw CompiledFileException(error_message,
+                                    ParserResultType::kObjectIsNotValid);
+    }
+}
+
+void CompiledFile::LoadAttribute(
+    const AttributeRecord& record, Object& object) const
+{
+    Attribute* attribute = object.GetAttribute(this->GetName(record.name));
+    if (!attribute)
+        throw InvalidCompiledFile("attribute does not exist");
+
+    if (static_cast<uint32_t>(attribute->type) != record.type)
+        throw InvalidCompiledFile("wrong attribute type");
+
+    // The values are loaded with the type of the attribute, so no
+    // conversion takes place
+    AttributeValue value;
+    switch (attribute->type)
+    {
+    case AttributeType::kBool:
+        value = AttributeValue(record.bool_value != 0);
+        break;
+    case AttributeType::kFloat:
+        value = AttributeValue(record.float_value[0]);
+        break;
+    case AttributeType::kFloat2:
+        value = AttributeValue(AttributeValue::Vector2{
+            record.float_value[0], record.float_value[1] });
+        break;
+    case AttributeType::kFloat3:
+        value = AttributeValue(AttributeValue::Vector3{
+            record.float_value[0], record.float_value[1],
+            record.float_value[2] });
+        break;
+    case AttributeType::kFloat4:
+        value = AttributeValue(AttributeValue::Vector4{
+            record.float_value[0], record.float_value[1],
+            record.float_value[2], record.float_value[3] });
+        break;
+    case AttributeType::kInt:
+        value = AttributeValue(record.int_value);
+        break;
+    case AttributeType::kString:
+        value = AttributeValue(
+            std::string(this->GetString(record.string_value)));
+        break;
+    }
+
+    const bool loaded = attribute->LoadValue(value);
+
+    if (!loaded)
+        throw InvalidCompiledFile("unable to load attribute value");
+}
+
+void CompiledFile::LoadReferences(GlobalObject& dest) const
+{
+    const ReferenceRecord* references =
+        reinterpret_cast<const ReferenceRecord*>(
+            this->buffer_.Begin() + this->header_->references_offset);
+
+    dest.object_references_.Reserve(this->header_->reference_count);
+
+    for (uint32_t i = 0; i < this->header_->reference_count; i++)
+    {
+        const ReferenceRecord& reference = references[i];
+
+        if (reference.object >= this->header_->object_count ||
+            !this->loaded_objects_[reference.object])
+        {
+            throw InvalidCompiledFile("reference to undefined object");
+        }
+
+        // The full IDs are split into their segments again
+        ObjectReferences::NodeIndex node;
+        if (!dest.object_references_.Insert(ObjectReferences::kRoot,
+                this->GetString(reference.id),
+                *this->loaded_objects_[reference.object], node))
+        {
+            throw InvalidCompiledFile("object ID is defined multiple times");
+        }
+    }
+}
+
+std::vector<CompiledSource> CompiledFile::GetSources() const
+{
+    std::vector<CompiledSource> sources;
+    sources.reserve(this->header_->source_count);
+
+    for (uint32_t i = 0; i < this->header_->source_count; i++)
+    {
+        const SourceRecord& record = this->sources_in_[i];
+
+        sources.push_back({ std::string(this->GetString(record.path)),
+                            record.size, record.hash });
+    }
+
+    return sources;
+}
+
+std::string_view CompiledFile::GetString(uint32_t index) const
+{
+    if (index >= this->header_->string_count)
+        throw InvalidCompiledFile("string index out of range");
+
+    const StringRecord& string = this->strings_in_[index];
+
+    if (string.offset > this->header_->string_data_size ||
+        string.size > this->header_->string_data_size - string.offset)
+    {
+        throw InvalidCompiledFile("string out of range");
+    }
+
+    return std::string_view(this->string_data_in_ + string.offset,
+                            string.size);
+}
+
+Atom CompiledFile::GetName(uint32_t index) const
+{
+    if (index >= this->name_atoms_.size())
+        throw InvalidCompiledFile("name index out of range");
+
+    return this->name_atoms_[index];
+}
+
+}  // namespace imgui_markup::internal::parser
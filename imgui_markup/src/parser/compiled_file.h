@@ -0,0 +1,288 @@
+#ifndef IMGUI_MARKUP_SRC_PARSER_COMPILED_FILE_H_
+#define IMGUI_MARKUP_SRC_PARSER_COMPILED_FILE_H_
+
+#include "imgui_markup/parser/parser_result.h"
+#include "imgui_markup/parser/source_buffer.h"
+#include "imgui_markup/objects/global_object.h"
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace imgui_markup::internal::parser
+{
+
+/**
+ * Layout of a compiled markup file (.illc).
+ * A compiled file contains the object tree of a parsed file, including
+ * every included file. Every record is stored in the byte order and
+ * alignment of the machine that compiled the file, so that the records
+ * can be used directly from the memory mapped file.
+ *
+ * The file consists of the header followed by the source records,
+ * the string table, the object, attribute and reference records and the
+ * string data.
+ */
+namespace compiled_file
+{
+
+constexpr char     kMagic[4]  = { 'I', 'L', 'L', 'C' };
+constexpr uint32_t kByteOrder = 0x01020304;
+
+/**
+ * Has to be increased whenever the layout changes. Object type codes are
+ * builtin atom IDs, so the version has to be increased as well when
+ * atoms::Builtin changes.
+ */
+constexpr uint32_t kVersion = 3;
+
+/**
+ * Used for indices that do not point to a record, e.g. the parent of
+ * the global object.
+ */
+constexpr uint32_t kNone = UINT32_MAX;
+
+struct Header
+{
+    char     magic[4];
+    uint32_t byte_order;
+    uint32_t version;
+
+    /**
+     * The first name_count strings are names (object IDs and attribute
+     * names), which are interned into the atom table when the file is
+     * loaded. The other strings are string attribute values, the full IDs
+     * of the references and the source paths.
+     */
+    uint32_t string_count;
+    uint32_t name_count;
+    uint32_t object_count;
+    uint32_t attribute_count;
+    uint32_t reference_count;
+    uint32_t source_count;
+    uint32_t string_data_size;
+
+    // Offsets relative to the start of the file
+    uint32_t sources_offset;
+    uint32_t strings_offset;
+    uint32_t objects_offset;
+    uint32_t attributes_offset;
+    uint32_t references_offset;
+    uint32_t string_data_offset;
+};
+
+/**
+ * File that was used to generate the object tree, the first source is
+ * the main file. Used to detect if the compiled file is outdated.
+ */
+struct SourceRecord
+{
+    uint64_t hash;  // utils::HashData of the content
+    uint64_t size;
+    uint32_t path;  // String index, absolute path
+    uint32_t padding;
+};
+
+struct StringRecord
+{
+    uint32_t offset;  // Relative to the string data
+    uint32_t size;
+};
+
+/**
+ * Objects are stored in pre-order, the first object is the global object.
+ * The attributes of an object are stored next to each other.
+ */
+struct ObjectRecord
+{
+    uint32_t type;  // atoms::Builtin
+    uint32_t id;    // Name index
+    uint32_t parent;
+    uint32_t first_child;
+    uint32_t next_sibling;
+    uint32_t first_attribute;
+    uint32_t attribute_count;
+};
+
+/**
+ * Attribute that was set by the markup. The value is stored with the
+ * type of the attribute, attribute references are already resolved.
+ */
+struct AttributeRecord
+{
+    uint32_t name;  // Name index
+    uint32_t type;  // AttributeType
+
+    union
+    {
+        int32_t  int_value;
+        float    float_value[4];
+        uint32_t bool_value;
+        uint32_t string_value;  // String index
+    };
+};
+
+/**
+ * Entry of the object references of the global object.
+ */
+struct ReferenceRecord
+{
+    uint32_t id;  // String index of the full ID, which is not a name
+    uint32_t object;
+};
+
+}  // namespace compiled_file
+
+/**
+ * Source file of a compiled file, see compiled_file::SourceRecord.
+ */
+struct CompiledSource
+{
+    std::string path;
+    uint64_t size;
+    uint64_t hash;
+};
+
+/* Exceptions */
+struct CompiledFileException
+{
+    CompiledFileException(std::string message, ParserResultType type)
+        : message(message), type(type)
+    { }
+
+    const std::string message;
+    const ParserResultType type;
+};
+
+struct CompiledFileOutdated : public CompiledFileException
+{
+    CompiledFileOutdated()
+        : CompiledFileException("Compiled file is outdated, the source "
+                                "files were changed",
+                                ParserResultType::kCompiledFileOutdated)
+    { }
+};
+
+struct InvalidCompiledFile : public CompiledFileException
+{
+    InvalidCompiledFile(std::string reason)
+        : CompiledFileException("Invalid compiled file: " + reason,
+                                ParserResultType::kInvalidCompiledFile)
+    { }
+};
+
+/**
+ * Writes object trees to compiled files and loads them again.
+ * Loading a compiled file skips the lexer, parser and interpreter,
+ * the objects are created directly from the records and the attribute
+ * values are loaded without any string conversion.
+ */
+class CompiledFile
+{
+public:
+    /**
+     * Writes an object tree that was generated by the parser to a
+     * compiled file.
+     *
+     * @param source  - Global object that was filled by the parser.
+     * @param path    - Path of the compiled file, an existing file is
+     *                  overwritten.
+     * @param sources - Files that were used to generate the object tree,
+     *                  starting with the main file.
+     */
+    ParserResult Write(const GlobalObject& source, const std::string& path,
+                       const std::vector<CompiledSource>& sources = { });
+
+    /**
+     * Loads the object tree of a compiled file.
+     * The global object is reset before the file is loaded and will be
+     * empty if the file is invalid.
+     *
+     * @param path - Path of the compiled file.
+     * @param dest - Global object receiving the object tree.
+     * @param check_sources - Optional, called with the source files before
+     *                        any object is created. The file is not loaded
+     *                        and kCompiledFileOutdated is returned if the
+     *                        function returns false.
+     */
+    ParserResult Load(const std::string& path, GlobalObject& dest,
+                      const std::function<bool(
+                          const std::vector<CompiledSource>&)>&
+                          check_sources = nullptr);
+
+private:
+    // Write state
+    std::vector<compiled_file::StringRecord>    strings_;
+    std::vector<compiled_file::ObjectRecord>    objects_;
+    std::vector<compiled_file::AttributeRecord> attributes_;
+    std::vector<compiled_file::ReferenceRecord> references_;
+    std::vector<compiled_file::SourceRecord>    sources_;
+    std::string string_data_;
+
+    /**
+     * Index of every name and object that was already written.
+     */
+    std::unordered_map<Atom, uint32_t> names_;
+    std::unordered_map<const Object*, uint32_t> object_indices_;
+
+    /**
+     * String attribute values, which are added to the string table
+     * after every name was added.
+     */
+    std::vector<const std::string*> string_values_;
+
+    /**
+     * Full IDs of the references, which are added to the string table
+     * after the string values. Only their segments are interned when the
+     * file is loaded.
+     */
+    std::vector<std::string> reference_ids_;
+
+    // Load state
+    SourceBuffer buffer_;
+    const compiled_file::Header*          header_         = nullptr;
+    const compiled_file::SourceRecord*    sources_in_     = nullptr;
+    const compiled_file::StringRecord*    strings_in_     = nullptr;
+    const compiled_file::ObjectRecord*    objects_in_     = nullptr;
+    const compiled_file::AttributeRecord* attributes_in_  = nullptr;
+    const char*                           string_data_in_ = nullptr;
+
+    /**
+     * Atoms of the names inside the file.
+     */
+    std::vector<Atom> name_atoms_;
+
+    /**
+     * Every object that was created, by record index.
+     */
+    std::vector<Object*> loaded_objects_;
+
+    void Reset();
+
+    // Write functions
+    uint32_t AddName(Atom name);
+    uint32_t AddString(std::string_view value);
+    void WriteObject(const Object& object, uint32_t parent);
+    void WriteAttribute(Atom name, const Attribute& attribute);
+    void WriteReferences(const GlobalObject& source);
+    void WriteFile(const std::string& path) const;
+
+    // Load functions
+    void OpenFile(const std::string& path);
+    void LoadObject(uint32_t index, Object& object);
+    void LoadChildObject(uint32_t index, Object& parent);
+    void LoadAttribute(const compiled_file::AttributeRecord& record,
+                       Object& object) const;
+    void LoadReferences(GlobalObject& dest) const;
+    std::vector<CompiledSource> GetSources() const;
+
+    std::string_view GetString(uint32_t index) const;
+    Atom GetName(uint32_t index) const;
+};
+
+}  // namespace imgui_markup::internal::parser
+
+#endif  // IMGUI_MARKUP_SRC_PARSER_COMPILED_FILE_H_
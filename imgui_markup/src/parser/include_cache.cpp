@@ -0,0 +1,50 @@
+#include "impch.h"
+#include "parser/include_cache.h"
+
+namespace imgui_markup::internal::parser
+{
+
+IncludeCache& IncludeCache::Get()
+{
+    static IncludeCache cache;
+    return cache;
+}
+
+std::shared_ptr<const CachedFile> IncludeCache::Find(
+    const FileIdentity& identity)
+{
+    std::lock_guard<std::mutex> lock(this->mutex_);
+
+    const auto it = this->files_.find({ identity.device, identity.inode });
+    if (it == this->files_.end() || !(it->second->identity == identity))
+        return nullptr;
+
+    return it->second;
+}
+
+void IncludeCache::Insert(std::shared_ptr<const CachedFile> file)
+{
+    if (!file)
+        return;
+
+    std::lock_guard<std::mutex> lock(this->mutex_);
+
+    this->files_[{ file->identity.device, file->identity.inode }] =
+        std::move(file);
+}
+
+void IncludeCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(this->mutex_);
+
+    this->files_.clear();
+}
+
+size_t IncludeCache::KeyHash::operator()(
+    const std::pair<uint64_t, uint64_t>& key) const
+{
+    return std::hash<uint64_t>()(key.first) ^
+           (std::hash<uint64_t>()(key.second) * 0x9E3779B97F4A7C15ull);
+}
+
+}  // namespace imgui_markup::internal::parser
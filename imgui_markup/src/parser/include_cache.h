@@ -0,0 +1,102 @@
+#ifndef IMGUI_MARKUP_SRC_PARSER_INCLUDE_CACHE_H_
+#define IMGUI_MARKUP_SRC_PARSER_INCLUDE_CACHE_H_
+
+#include "imgui_markup/parser/lexer.h"
+#include "imgui_markup/parser/source_buffer.h"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace imgui_markup::internal::parser
+{
+
+/**
+ * Content and token stream of an included file.
+ * The tokens are generated once and replayed every time the file is
+ * included. Include instructions inside the file are not resolved,
+ * because their paths depend on the path that was used to include the file.
+ */
+struct CachedFile
+{
+    FileIdentity identity;
+
+    /**
+     * Entire content of the file, the tokens point into it.
+     */
+    SourceBuffer buffer;
+
+    /**
+     * Tokens of the file, the file IDs of the locations are not set.
+     */
+    std::vector<LexerToken,
+                MemoryAllocator<LexerToken, MemorySubsystem::kLexer>> tokens;
+
+    /**
+     * Include instruction inside the file. The file is included before
+     * the token at token_index, the argument is the path token.
+     */
+    struct Include
+    {
+        size_t token_index;
+        LexerToken argument;
+    };
+    std::vector<Include,
+                MemoryAllocator<Include, MemorySubsystem::kLexer>> includes;
+
+    /**
+     * Set if the file could not be tokenized. The error is thrown
+     * after the last token was replayed.
+     */
+    std::optional<LexerException> error;
+};
+
+/**
+ * Process wide cache of included files, shared by every lexer.
+ * Files are keyed by device and inode, the cached file is only used if
+ * the modification time and size did not change.
+ * The cache is thread safe, cached files are immutable.
+ */
+class IncludeCache
+{
+public:
+    static IncludeCache& Get();
+
+    /**
+     * Gets the cached file with the given identity.
+     *
+     * @return nullptr if the file is not cached or was changed.
+     */
+    std::shared_ptr<const CachedFile> Find(const FileIdentity& identity);
+
+    /**
+     * Adds a file to the cache, replacing older versions of the file.
+     */
+    void Insert(std::shared_ptr<const CachedFile> file);
+
+    /**
+     * Removes every file from the cache. Files that are currently used
+     * by a lexer stay valid until the lexer is reset.
+     */
+    void Clear();
+
+private:
+    IncludeCache() = default;
+
+    struct KeyHash
+    {
+        size_t operator()(const std::pair<uint64_t, uint64_t>& key) const;
+    };
+
+    std::mutex mutex_;
+    std::unordered_map<std::pair<uint64_t, uint64_t>,
+                       std::shared_ptr<const CachedFile>, KeyHash> files_;
+};
+
+}  // namespace imgui_markup::internal::parser
+
+#endif  // IMGUI_MARKUP_SRC_PARSER_INCLUDE_CACHE_H_
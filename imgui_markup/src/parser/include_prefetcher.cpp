@@ -0,0 +1,210 @@
+#include "impch.h"
+#include "parser/include_prefetcher.h"
+
+#include "imgui_markup/common/atom.h"
+#include "parser/lexer_scanner.h"
+
+namespace imgui_markup::internal::parser
+{
+
+namespace
+{
+
+std::string JoinPath(const std::string& directory, const std::string& path)
+{
+    return directory.empty() ? path : directory + '/' + path;
+}
+
+}  // namespace
+
+utils::ThreadPool& IncludePrefetcher::GetThreadPool()
+{
+    // The tasks insert the files into the include cache and the names of
+    // their tokens into the atom table
+    static utils::ThreadPool& pool = []() -> utils::ThreadPool&
+    {
+        IncludeCache::Get();
+
+        Atom atom;
+        Atom::Find("", atom);
+
+        return utils::ThreadPool::Get();
+    }();
+
+    return pool;
+}
+
+std::shared_ptr<IncludePrefetcher> IncludePrefetcher::Start(
+    const std::string& path, std::string_view data)
+{
+    std::vector<std::string> includes;
+    IncludePrefetcher::ScanIncludes(
+        std::filesystem::path(path).parent_path().string(), data, includes);
+
+    // The thread pool is not started for only a few files
+    if (includes.size() < kMinIncludeCount)
+        return nullptr;
+
+    std::shared_ptr<IncludePrefetcher> prefetcher =
+        std::make_shared<IncludePrefetcher>();
+
+    for (const std::string& include : includes)
+        prefetcher->Prefetch(include);
+
+    return prefetcher;
+}
+
+std::shared_ptr<const CachedFile> IncludePrefetcher::Wait(
+    const std::string& path)
+{
+    Future future;
+
+    {
+        std::lock_guard<std::mutex> lock(this->mutex_);
+
+        const auto it = this->files_.find(path);
+        if (it == this->files_.end())
+            return nullptr;
+
+        future = it->second;
+    }
+
+    // The lexer might run on the thread pool itself, e.g. when multiple
+    // files are parsed at once
+    return IncludePrefetcher::GetThreadPool().Wait(future);
+}
+
+void IncludePrefetcher::ScanIncludes(const std::string& directory,
+                                     std::string_view data,
+                                     std::vector<std::string>& dest)
+{
+    static constexpr std::string_view kInstruction = "include";
+
+    // Comments and strings are skipped the same way the lexer skips them,
+    // so that only real include instructions are prefetched
+    const char* cursor = data.data();
+    const char* end    = data.data() + data.size();
+
+    while (true)
+    {
+        cursor = scanner::SkipWhitespaceAndComments(cursor, end);
+        if (cursor >= end)
+            return;
+
+        const char c = *cursor++;
+
+        if (c == '"')
+        {
+            cursor = scanner::FindStringEnd(cursor, end);
+            if (cursor >= end)
+                return;
+
+            cursor++;
+            continue;
+        }
+
+        if (c != '@')
+            continue;
+
+        const char* instruction_end = cursor;
+        while (instruction_end < end &&
+               !scanner::IsWhitespace(*instruction_end))
+        {
+            instruction_end++;
+        }
+
+        const std::string_view instruction(cursor, instruction_end - cursor);
+        cursor = instruction_end;
+
+        if (instruction != kInstruction)
+            continue;
+
+        cursor = scanner::SkipWhitespaceAndComments(cursor, end);
+        if (cursor >= end || *cursor != '"')
+            continue;
+
+        const char* argument = ++cursor;
+        cursor = scanner::FindStringEnd(cursor, end);
+        if (cursor >= end)
+            return;
+
+        dest.push_back(JoinPath(directory, Lexer::UnescapeString(
+            std::string_view(argument, cursor - argument))));
+
+        cursor++;
+    }
+}
+
+void IncludePrefetcher::Prefetch(const std::string& path)
+{
+    std::shared_ptr<Promise> promise = std::make_shared<Promise>();
+
+    {
+        std::lock_guard<std::mutex> lock(this->mutex_);
+
+        if (!this->files_.emplace(path, promise->get_future().share()).second)
+            return;
+    }
+
+    IncludePrefetcher::GetThreadPool().Submit(
+        [prefetcher = this->shared_from_this(), path, promise]()
+        {
+            prefetcher->Load(path, *promise);
+        },
+        utils::ThreadPool::TaskType::kHelper);
+}
+
+void IncludePrefetcher::Load(const std::string& path, Promise& promise)
+{
+    std::shared_ptr<const CachedFile> file;
+
+    // Every error is reported by the lexer when the file is included
+    try
+    {
+        FileIdentity identity;
+        if (GetFileIdentity(path, identity))
+        {
+            file = IncludeCache::Get().Find(identity);
+            if (!file)
+            {
+                Lexer lexer;
+                file = lexer.CacheFile(path, identity, LexerToken());
+                IncludeCache::Get().Insert(file);
+            }
+        }
+    }
+    catch (...)
+    {
+        file = nullptr;
+    }
+
+    promise.set_value(file);
+
+    if (!file)
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(this->mutex_);
+
+        if (!this->expanded_files_.insert(
+                { file->identity.device, file->identity.inode }).second)
+        {
+            return;
+        }
+    }
+
+    const std::string directory =
+        std::filesystem::path(path).parent_path().string();
+
+    for (const auto& include : file->includes)
+    {
+        // The argument is a string token, including the quotes
+        const SourceLocation& location = include.argument.location;
+        const std::string_view argument(
+            file->buffer.Begin() + location.offset + 1, location.length - 2);
+
+        this->Prefetch(JoinPath(directory, Lexer::UnescapeString(argument)));
+    }
+}
+
+}  // namespace imgui_markup::internal::parser
@@ -0,0 +1,117 @@
+#ifndef IMGUI_MARKUP_SRC_PARSER_INCLUDE_PREFETCHER_H_
+#define IMGUI_MARKUP_SRC_PARSER_INCLUDE_PREFETCHER_H_
+
+#include "parser/include_cache.h"
+#include "utility/thread_pool.h"
+
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace imgui_markup::internal::parser
+{
+
+/**
+ * Loads and tokenizes the include graph of a file on the thread pool,
+ * while the lexer processes the file.
+ * The include instructions of the main file are found by a simple scan
+ * for "@include" directives, the include instructions of the included
+ * files are taken from their cached token streams.
+ * Errors are ignored, they are reported by the lexer when the file
+ * is included.
+ *
+ * Files with only a few include instructions are not prefetched, because
+ * loading a few files while they are included is cheaper than starting
+ * the thread pool and waiting for its tasks.
+ */
+class IncludePrefetcher
+    : public std::enable_shared_from_this<IncludePrefetcher>
+{
+public:
+    /**
+     * Minimum number of include instructions inside the main file, for
+     * which the included files are prefetched.
+     */
+    static constexpr size_t kMinIncludeCount = 4;
+
+    /**
+     * Process wide thread pool, which runs the prefetch tasks.
+     * The process wide objects that the tasks use are created before the
+     * pool, so that they are destroyed after the pool processed the
+     * remaining tasks and stopped its worker threads.
+     * Every user of the pool inside the parser has to get it from here.
+     */
+    static utils::ThreadPool& GetThreadPool();
+
+    /**
+     * Scans the data of a file for include instructions and starts loading
+     * the included files.
+     *
+     * @param path - Absolute path of the file.
+     * @param data - Content of the file.
+     * @return nullptr if the file contains less than kMinIncludeCount
+     *         include instructions, the lexer loads the files itself then.
+     */
+    static std::shared_ptr<IncludePrefetcher> Start(const std::string& path,
+                                                    std::string_view data);
+
+    /**
+     * Waits until the file is loaded.
+     *
+     * @param path - Path of the file, built the same way as the paths of
+     *               the include instructions inside the lexer.
+     * @return nullptr if the file was not prefetched or could not be loaded.
+     */
+    std::shared_ptr<const CachedFile> Wait(const std::string& path);
+
+private:
+    using Future = std::shared_future<std::shared_ptr<const CachedFile>>;
+    using Promise = std::promise<std::shared_ptr<const CachedFile>>;
+
+    std::mutex mutex_;
+
+    /**
+     * Every file that was submitted, by path.
+     */
+    std::unordered_map<std::string, Future> files_;
+
+    /**
+     * Device and inode of every file whose includes were already submitted.
+     * Prevents endless recursion of files including each other.
+     */
+    std::set<std::pair<uint64_t, uint64_t>> expanded_files_;
+
+    /**
+     * Finds every include instruction inside the data.
+     *
+     * @param directory - Directory of the file, used to build the paths.
+     * @param data      - Content of the file.
+     * @param dest      - Receives the path of every included file.
+     */
+    static void ScanIncludes(const std::string& directory,
+                             std::string_view data,
+                             std::vector<std::string>& dest);
+
+    /**
+     * Submits a file to the thread pool, if it was not already submitted.
+     */
+    void Prefetch(const std::string& path);
+
+    /**
+     * Loads the file through the include cache and submits the files
+     * that are included by the file. Runs on the thread pool as a helper
+     * task, so it must never wait for other tasks.
+     */
+    void Load(const std::string& path, Promise& promise);
+};
+
+}  // namespace imgui_markup::internal::parser
+
+#endif  // IMGUI_MARKUP_SRC_PARSER_INCLUDE_PREFETCHER_H_
@@ -8,74 +8,126 @@ namespace imgui_markup::internal::parser
 
 /* Interpreter */
 void Interpreter::ConvertNodeTree(
-    const std::shared_ptr<ParserNode>& root_node, GlobalObject& dest)
+    const ParserNode& root_node, GlobalObject& dest)
 {
     this->Reset();
 
-    this->InitObjectReference(dest, *root_node.get());
-    this->ProcessNodes(*root_node.get(), dest);
+    this->InitObjectReference(dest, root_node);
+    this->ProcessNodes(root_node, dest);
 
-    dest.object_references_ = this->object_references_;
+    this->MoveObjectReferences(dest);
+}
+
+void Interpreter::BeginStream(const ParserNode& root_node, GlobalObject& dest)
+{
+    this->Reset();
+
+    this->InitObjectReference(dest, root_node);
+    this->object_stack_.push_back(&dest);
+}
+
+void Interpreter::StreamObjectBegin(const ParserNode& node)
+{
+    Object& object = this->BeginObjectNode(node, *this->object_stack_.back());
+    this->object_stack_.push_back(&object);
+}
+
+void Interpreter::StreamAttributeAssign(const ParserNode& node)
+{
+    this->ProcessAttributeAssignNode(node, *this->object_stack_.back());
+}
+
+void Interpreter::StreamObjectEnd(const ParserNode& node)
+{
+    Object& object = *this->object_stack_.back();
+    this->object_stack_.pop_back();
+
+    this->EndObjectNode(node, object);
+}
+
+void Interpreter::EndStream(GlobalObject& dest)
+{
+    this->object_stack_.clear();
+
+    this->MoveObjectReferences(dest);
 }
 
 void Interpreter::Reset()
 {
-    this->object_references_.clear();
+    this->object_references_.Clear();
+    this->object_stack_.clear();
+    this->reference_scopes_.clear();
+
+    // The index was moved to the last global object, so the memory is
+    // allocated once for the expected number of references
+    this->object_references_.Reserve(this->reference_count_hint_);
+}
+
+void Interpreter::MoveObjectReferences(GlobalObject& dest)
+{
+    this->reference_count_hint_ = this->object_references_.Size();
+
+    dest.object_references_ = std::move(this->object_references_);
+    this->object_references_.Clear();
 }
 
 void Interpreter::InitObjectReference(
     Object& object, const ParserNode& node)
 {
-    if (object.GetID().empty())
-        return;
+    // The scope is the node of the nearest parent object with an ID
+    const ObjectReferences::NodeIndex scope = this->reference_scopes_.empty()
+        ? ObjectReferences::kRoot : this->reference_scopes_.back();
 
-    std::string full_id = object.GetID();
-
-    Object* parent = &object;
-    while (true)
+    if (object.GetIDAtom().Empty())
     {
-        parent = parent->GetParent();
-
-        if (!parent)
-            break;
-        if (parent->GetID().empty())
-            continue;
-        if (parent->GetID() == "global")
-            continue;
-
-        full_id.insert(0, parent->GetID() + '.');
+        this->reference_scopes_.push_back(scope);
+        return;
     }
 
-    if (this->object_references_.find(full_id) !=
-        this->object_references_.end())
+    ObjectReferences::NodeIndex object_node;
+    if (!this->object_references_.Insert(
+            scope, object.GetIDAtom(), object, object_node))
     {
-        throw ObjectIDAlreadyDefined(full_id, node);
+        throw ObjectIDAlreadyDefined(
+            this->object_references_.GetFullID(object_node), node);
     }
 
-    this->object_references_.insert(
-        std::pair<std::string, Object&>(full_id, object));
+    // The ID of the global object is not part of the full IDs
+    this->reference_scopes_.push_back(
+        object.GetIDAtom() == atoms::kGlobal ? scope : object_node);
 }
 
 void Interpreter::ProcessNodes(
     const ParserNode& node, Object& parent_object)
 {
-    for (const auto& child : node.child_nodes)
+    for (const ParserNode* child = node.first_child; child;
+         child = child->next_sibling)
     {
         switch (child->type)
         {
         case ParserNodeType::kObjectNode:
-            this->ProcessObjectNode(*child.get(), parent_object);
+            this->ProcessObjectNode(*child, parent_object);
             break;
         case ParserNodeType::kAttributeAssignNode:
-            this->ProcessAttributeAssignNode(*child.get(), parent_object);
+            this->ProcessAttributeAssignNode(*child, parent_object);
             break;
         default:
-            throw WrongBaseNode(*child.get());
+            throw WrongBaseNode(*child);
         }
     }
 }
 
 void Interpreter::ProcessObjectNode(
+    const ParserNode& node, Object& parent_object)
+{
+    Object& object = this->BeginObjectNode(node, parent_object);
+
+    this->ProcessNodes(node, object);
+
+    this->EndObjectNode(node, object);
+}
+
+Object& Interpreter::BeginObjectNode(
     const ParserNode& node_in, Object& parent_object)
 {
     if (node_in.type != ParserNodeType::kObjectNode)
@@ -83,8 +135,8 @@ void Interpreter::ProcessObjectNode(
 
     ParserObjectNode& node = (ParserObjectNode&)node_in;
 
-    std::shared_ptr<Object> object = ObjectList::CreateObject(
-        node.object_type, node.object_id, &parent_object);
+    Object* object = ObjectList::CreateObject(
+        node.object_type, node.object_id, parent_object);
 
     if (!object)
         throw UndefinedObjectType(node);
@@ -93,16 +145,22 @@ void Interpreter::ProcessObjectNode(
     if (!object->Validate(error_message))
         throw ObjectIsNotValid(error_message, node);
 
-    parent_object.AddChild(object);
+    parent_object.AddChild(*object);
 
-    this->InitObjectReference(*object.get(), node);
+    this->InitObjectReference(*object, node);
 
     if (!object->OnProcessStart(error_message))
         throw ObjectIsNotValid(error_message, node);
 
-    this->ProcessNodes(node_in, *object.get());
+    return *object;
+}
+
+void Interpreter::EndObjectNode(const ParserNode& node, Object& object)
+{
+    this->reference_scopes_.pop_back();
 
-    if (!object->OnProcessEnd(error_message))
+    std::string error_message;
+    if (!object.OnProcessEnd(error_message))
         throw ObjectIsNotValid(error_message, node);
 }
 
@@ -117,27 +175,40 @@ void Interpreter::ProcessAttributeAssignNode(
     if (!node.value_node)
         throw MissingAttributeValue(node);
 
-    std::shared_ptr<Attribute> value =
-        this->ProcessValueNode(*node.value_node.get(), parent_object);
+    // Vector values are only used for the assignment, so they are not
+    // allocated
+    if (node.value_node->type == ParserNodeType::kVectorNode)
+    {
+        this->ProcessVectorNode(*node.value_node, parent_object,
+            [&](const AttributeValue& value)
+            { this->AssignAttributeValue(node, parent_object, value); });
+        return;
+    }
 
-    if (!value)
-        throw AttributeConversionError("Undefined", "Undefined", node);
+    this->AssignAttributeValue(node, parent_object,
+        this->ProcessValueNode(*node.value_node, parent_object));
+}
 
+void Interpreter::AssignAttributeValue(const ParserAttributeAssignNode& node,
+                                       Object& parent_object,
+                                       const AttributeValue& value) const
+{
     Attribute* attribute = parent_object.GetAttribute(node.attribute_name);
     if (!attribute)
     {
         throw AttributeDoesNotExists(
-            parent_object.GetType(), node.attribute_name, node);
+            parent_object.GetType(), node.attribute_name.String(), node);
     }
 
-    if (!attribute->LoadValue(*value))
+    if (!attribute->LoadValue(value))
     {
         throw AttributeConversionError(this->AttributeTypeToString(*attribute),
-            this->AttributeTypeToString(*value), value->ToString(), node);
+            this->AttributeTypeToString(value.GetType()), value.ToString(),
+            node);
     }
 }
 
-String Interpreter::ProcessStringNode(
+AttributeValue Interpreter::ProcessStringNode(
     const ParserNode& node_in) const
 {
     if (node_in.type != ParserNodeType::kStringNode)
@@ -145,10 +216,10 @@ String Interpreter::ProcessStringNode(
 
     ParserStringNode& node = (ParserStringNode&)node_in;
 
-    return String(node.value);
+    return AttributeValue(node.value.value);
 }
 
-Int Interpreter::ProcessIntNode(
+AttributeValue Interpreter::ProcessIntNode(
     const ParserNode& node_in) const
 {
     if (node_in.type != ParserNodeType::kIntNode)
@@ -156,14 +227,11 @@ Int Interpreter::ProcessIntNode(
 
     ParserIntNode& node = (ParserIntNode&)node_in;
 
-    Int value;
-    if (!value.LoadValue(String(node.value)))
-        throw AttributeConversionError("Int", node.value, node_in);
-
-    return value;
+    // The value was already converted by the lexer
+    return AttributeValue(node.value);
 }
 
-Float Interpreter::ProcessFloatNode(
+AttributeValue Interpreter::ProcessFloatNode(
     const ParserNode& node_in) const
 {
     if (node_in.type != ParserNodeType::kFloatNode)
@@ -171,14 +239,11 @@ Float Interpreter::ProcessFloatNode(
 
     ParserFloatNode& node = (ParserFloatNode&)node_in;
 
-    Float value;
-    if (!value.LoadValue(String(node.value)))
-        throw AttributeConversionError("Float", node.value, node_in);
-
-    return value;
+    // The value was already converted by the lexer
+    return AttributeValue(node.value);
 }
 
-Bool Interpreter::ProcessBoolNode(
+AttributeValue Interpreter::ProcessBoolNode(
     const ParserNode& node_in) const
 {
     if (node_in.type != ParserNodeType::kBoolNode)
@@ -186,81 +251,168 @@ Bool Interpreter::ProcessBoolNode(
 
     ParserBoolNode& node = (ParserBoolNode&)node_in;
 
-    Bool value;
-    if (!value.LoadValue(String(node.value)))
+    bool value;
+    if (!utils::StringToBool(node.value, &value))
         throw AttributeConversionError("Bool", node.value, node_in);
 
-    return value;
+    return AttributeValue(value);
 }
 
-std::shared_ptr<Attribute> Interpreter::ProcessVectorNode(
-    const ParserNode& node_in, Object& parent_object) const
+template<typename Function>
+void Interpreter::ProcessVectorNode(const ParserNode& node_in,
+                                    Object& parent_object,
+                                    const Function& function) const
 {
     if (node_in.type != ParserNodeType::kVectorNode)
             throw InternalWrongNodeType(node_in);
 
-    ParserVectorNode& node = (ParserVectorNode&)node_in;
-
-    std::string value;
+    float values[4] = { };
     size_t value_count = 0;
+    bool converted = true;
 
-    for (const auto& child : node.child_nodes)
+    // Every value is processed, so that errors of attribute access
+    // nodes are reported before conversion errors
+    for (const ParserNode* child = node_in.first_child; child;
+         child = child->next_sibling)
     {
-        if (!value.empty())
-            value += ',';
+        float value = 0;
+        if (!this->ProcessVectorValue(*child, parent_object, value))
+            converted = false;
 
-        value +=
-            this->ProcessValueNode(*child.get(), parent_object)->ToString();
+        if (value_count < 4)
+            values[value_count] = value;
 
         value_count++;
     }
 
+    const char* type_name = "Vector";
+    switch (value_count)
+    {
+    case 2: type_name = "Float2"; break;
+    case 3: type_name = "Float3"; break;
+    case 4: type_name = "Float4"; break;
+    default: converted = false; break;
+    }
+
+    if (!converted)
+    {
+        throw AttributeConversionError(type_name,
+            this->VectorNodeToString(node_in, parent_object), node_in);
+    }
+
     if (value_count == 2)
     {
-        Float2 final_value;
-        if (!final_value.LoadValue(String(value)))
-            throw AttributeConversionError("Float2", value, node_in);
-        return std::make_shared<Float2>(final_value);
+        function(AttributeValue(
+            AttributeValue::Vector2{ values[0], values[1] }));
     }
     else if (value_count == 3)
     {
-        Float3 final_value;
-        if (!final_value.LoadValue(String(value)))
-            throw AttributeConversionError("Float3", value, node_in);
-        return std::make_shared<Float3>(final_value);
+        function(AttributeValue(
+            AttributeValue::Vector3{ values[0], values[1], values[2] }));
+    }
+    else
+    {
+        function(AttributeValue(AttributeValue::Vector4{
+            values[0], values[1], values[2], values[3] }));
+    }
+}
+
+AttributeValue Interpreter::ProcessVectorNode(
+    const ParserNode& node, Object& parent_object) const
+{
+    AttributeValue result;
+
+    this->ProcessVectorNode(node, parent_object,
+        [&result](const AttributeValue& value) { result = value; });
+
+    return result;
+}
+
+bool Interpreter::ProcessVectorValue(const ParserNode& node,
+                                     Object& parent_object,
+                                     float& dest) const
+{
+    const auto string_to_float = [&dest](std::string_view value)
+    {
+        // Every ',' would start a new value of the vector
+        if (value.find(',') != value.npos)
+            return false;
+
+        return utils::StringToFloat(value, &dest);
+    };
+
+    switch (node.type)
+    {
+    case ParserNodeType::kIntNode:
+        dest = static_cast<float>(this->ProcessIntNode(node).Get<int>());
+        return true;
+    case ParserNodeType::kFloatNode:
+        dest = this->ProcessFloatNode(node).Get<float>();
+        return true;
+    case ParserNodeType::kStringNode:
+        return string_to_float(((const ParserStringNode&)node).value.value);
+    case ParserNodeType::kBoolNode:
+    case ParserNodeType::kVectorNode:
+        return false;
+    case ParserNodeType::kAttributeAccessNode:
+        break;
+    default:
+        throw UnknownAttributeValueType(node);
     }
-    else if (value_count == 4)
+
+    const Attribute& attribute =
+        this->ProcessAttributeAccessNode(node, parent_object);
+
+    switch (attribute.type)
     {
-        Float4 final_value;
-        if (!final_value.LoadValue(String(value)))
-            throw AttributeConversionError("Float4", value, node_in);
-        return std::make_shared<Float4>(final_value);
+    case AttributeType::kInt:
+        dest = static_cast<float>(((const Int&)attribute).value);
+        return true;
+    case AttributeType::kFloat:
+        dest = ((const Float&)attribute).value;
+        return true;
+    case AttributeType::kString:
+        return string_to_float(((const String&)attribute).value);
+    default:
+        return false;
     }
+}
 
-    throw AttributeConversionError("Vector", value, node_in);
+std::string Interpreter::VectorNodeToString(const ParserNode& node,
+                                            Object& parent_object) const
+{
+    std::string value;
+
+    for (const ParserNode* child = node.first_child; child;
+         child = child->next_sibling)
+    {
+        if (!value.empty())
+            value += ',';
+
+        value += this->ProcessValueNode(*child, parent_object).ToString();
+    }
+
+    return value;
 }
 
-std::shared_ptr<Attribute> Interpreter::ProcessValueNode(
+AttributeValue Interpreter::ProcessValueNode(
     const ParserNode& node, Object& parent_object) const
 {
     switch (node.type)
     {
     case ParserNodeType::kStringNode:
-        return std::make_shared<String>(this->ProcessStringNode(node));
+        return this->ProcessStringNode(node);
     case ParserNodeType::kIntNode:
-        return std::make_shared<Int>(this->ProcessIntNode(node));
+        return this->ProcessIntNode(node);
     case ParserNodeType::kFloatNode:
-        return std::make_shared<Float>(this->ProcessFloatNode(node));
+        return this->ProcessFloatNode(node);
     case ParserNodeType::kBoolNode:
-        return std::make_shared<Bool>(this->ProcessBoolNode(node));
+        return this->ProcessBoolNode(node);
     case ParserNodeType::kVectorNode:
         return this->ProcessVectorNode(node, parent_object);
     case ParserNodeType::kAttributeAccessNode:
-        return std::shared_ptr<Attribute>(
-            &this->ProcessAttributeAccessNode(node, parent_object),
-                [](Attribute*){});  // Used that the pointer does not delete
-                                    // the attribute. This will be changed
-                                    // when references are implemented.
+        return this->ProcessAttributeAccessNode(node, parent_object)
+            .GetValue();
     default:
         throw UnknownAttributeValueType(node);
     }
@@ -274,96 +426,63 @@ Attribute& Interpreter::ProcessAttributeAccessNode(
 
     ParserAttributeAccessNode& node = (ParserAttributeAccessNode&)node_in;
 
-    std::string attribute = node.attribute_name;
-
     // We will assume a reference to a attribute of the current object
-    // if the attribute name does not contain '.'
-    if (attribute.find('.') == std::string::npos)
-        return this->GetAttributeFromObject(attribute, parent_object, node);
+    // if the attribute name does not contain '.', which is the only case
+    // where the lexer interned the name
+    if (!node.attribute_name.Empty())
+    {
+        return this->GetAttributeFromObject(
+            node.attribute_name, parent_object, node);
+    }
 
-    return this->GetAttribtueFromObjectReference(attribute, node);
+    return this->GetAttribtueFromObjectReference(node.reference, node);
 }
 
 
 Attribute& Interpreter::GetAttributeFromObject(
-    const std::string attribute_name,
+    const Atom attribute_name,
     Object& object,
     const ParserNode& node) const
 {
     Attribute* attribute = object.GetAttribute(attribute_name);
     if (!attribute)
-        throw AttributeDoesNotExists(object.GetType(), attribute_name, node);
+    {
+        throw AttributeDoesNotExists(
+            object.GetType(), attribute_name.String(), node);
+    }
 
     return *attribute;
 }
 
 Attribute& Interpreter::GetAttribtueFromObjectReference(
-    std::string attribute, const ParserNode& node) const
+    std::string_view attribute, const ParserNode& node) const
 {
-    std::string object_id =
-        this->GetObjectNameFromAttributeReferenceString(attribute, node);
-
-    if (object_id.size() >= attribute.size())
-        throw NoAttributeSpecified(node);
+    if (attribute.size() <= 3)
+        throw InvalidObjectID(std::string(attribute), node);
 
-    attribute = attribute.substr(object_id.size() + 1);
+    size_t object_id_size;
+    Object* object = this->object_references_.FindLongestPrefix(
+        attribute, object_id_size);
 
-    if (this->object_references_.find(object_id) ==
-        this->object_references_.end())
+    if (!object)
     {
-        throw ObjectIsNotDefined(object_id, node);
+        throw ObjectIsNotDefined(
+            std::string(attribute.substr(0, attribute.find('.'))), node);
     }
 
-    Object& object = this->object_references_.at(object_id);
+    if (object_id_size >= attribute.size())
+        throw NoAttributeSpecified(node);
 
-    const std::string type = object.GetType();
-    const std::string id   = object.GetID().empty() ?
-                                "null" : object.GetID();
+    attribute.remove_prefix(object_id_size + 1);
 
-    Attribute* att = object.GetAttribute(attribute);
+    Attribute* att = object->GetAttribute(attribute);
     if (!att)
-        throw AttributeDoesNotExists(object.GetType(), attribute, node);
-
-    return *att;
-}
-
-std::string Interpreter::GetObjectNameFromAttributeReferenceString(
-    const std::string attribute, const ParserNode& node) const
-{
-    if (attribute.size() <= 3)
-            throw InvalidObjectID(attribute, node);
-
-    const std::vector<std::string> segments =
-        utils::SplitString(attribute, '.');
-
-    if (segments.empty())
-        throw InvalidObjectID(attribute, node);
-
-    std::string object_id;
-    for (const auto& segment : segments)
-    {
-        std::string id = object_id;
-        if (!id.empty())
-            id += '.';
-
-        id += segment;
-        if (this->object_references_.find(id) == this->object_references_.end())
-        {
-            if (object_id.empty())
-                object_id = id;
-            break;
-        }
-
-        object_id = id;
-    }
-
-    if (this->object_references_.find(object_id) ==
-        this->object_references_.end())
     {
-        throw ObjectIsNotDefined(object_id, node);
+        throw AttributeDoesNotExists(
+            object->GetType(), std::string(attribute), node);
     }
 
-    return object_id;
+    return *att;
 }
 
 std::string Interpreter::AttributeTypeToString(const Attribute& attribute) const
@@ -1,24 +1,42 @@
 #include "impch.h"
 #include "imgui_markup/parser/lexer.h"
 
+#include "parser/include_cache.h"
+#include "parser/include_prefetcher.h"
+#include "parser/lexer_scanner.h"
 #include "utility/utility.h"
 
 namespace imgui_markup::internal::parser
 {
 
-/* Lexer Token */
-LexerToken::LexerToken()
-    : type(LexerTokenType::kUndefined), position(ParserPosition({}, "", 0, 0, 0))
-{ }
+namespace
+{
 
-LexerToken::LexerToken(const LexerTokenType type, const ParserPosition position)
-    : type(type), position(position)
-{ }
+// Used as the path of in-memory data
+const char kDataSourceName[] = "<data>";
 
-LexerToken::LexerToken(
-    const LexerTokenType type, const ParserPosition position,
-    const std::string data)
-    : type(type), position(position), data(data)
+// Sets the file of a token that was loaded from the include cache
+LexerToken RelocateToken(LexerToken token, uint16_t file_id)
+{
+    token.location.file_id = file_id;
+    return token;
+}
+
+std::string AbsolutePath(const std::string& path)
+{
+    const std::filesystem::path file_path(path);
+
+    if (file_path.is_absolute())
+        return path;
+
+    return std::filesystem::absolute(file_path).string();
+}
+
+}  // namespace
+
+/* Lexer Token */
+LexerToken::LexerToken(const LexerTokenType type, const SourceLocation location)
+    : type(type), location(location)
 { }
 
 /* Lexer */
@@ -26,25 +44,51 @@ void Lexer::InitFile(const std::string path)
 {
     this->Reset();
     this->OpenFile(path);
+
+    // The included files are loaded in the background while the main file
+    // is processed, unless there are only a few of them
+    const Source& source = this->sources_.front();
+    this->prefetcher_ = IncludePrefetcher::Start(source.path,
+        std::string_view(source.buffer.Begin(), source.buffer.Size()));
+}
+
+void Lexer::InitData(std::string_view data)
+{
+    this->Reset();
+
+    Source source(kDataSourceName, kInvalidFileID);
+    source.buffer.OpenView(data);
+    source.in_memory = true;
+
+    this->PushSource(std::move(source),
+                     LexerToken(LexerTokenType::kString, { }));
+}
+
+void Lexer::InitVirtualFile(const std::string path,
+                            const VirtualFileSystem& files)
+{
+    this->Reset();
+
+    this->virtual_files_ = &files;
+    this->OpenFile(path);
 }
 
 bool Lexer::GetNextToken(LexerToken& dest)
 {
     // Check if the token was already generated by the LookAhead function
-    if (!this->token_buffer_.empty())
+    if (this->token_buffer_size_ > 0)
     {
-        dest = this->token_buffer_.front();
-        this->token_buffer_.erase(this->token_buffer_.begin());
-
-        this->last_token_ = dest;
-
-        if (dest.type == LexerTokenType::kEOF)
-            return false;
+        dest = this->token_buffer_[this->token_buffer_start_];
 
-        return true;
+        this->token_buffer_start_ =
+            (this->token_buffer_start_ + 1) & (kLookAheadCapacity - 1);
+        this->token_buffer_size_--;
+    }
+    else
+    {
+        dest = this->GenerateToken();
     }
 
-    dest = this->GenerateToken();
     this->last_token_ = dest;
 
     if (dest.type == LexerTokenType::kEOF)
@@ -53,42 +97,146 @@ bool Lexer::GetNextToken(LexerToken& dest)
     return true;
 }
 
-LexerToken Lexer::LookAhead(size_t offset)
+const LexerToken& Lexer::LookAhead(size_t offset)
 {
     if (offset == 0)
         return this->last_token_;
 
-    // Check if the token was already generated
-    if (this->token_buffer_.size() >= offset)
-        return this->token_buffer_[offset - 1];
+    if (offset > kLookAheadCapacity)
+        return this->undefined_token_;
 
     // Generate every token until the offset is reached
-    for (unsigned int i = this->token_buffer_.size(); i < offset; i++)
+    while (this->token_buffer_size_ < offset)
     {
-        LexerToken token = this->GenerateToken();
-        this->token_buffer_.push_back(token);
-        if (token.type == LexerTokenType::kEOF)
-            return token;
-    }
+        // There are no more tokens after the end of the file
+        if (this->token_buffer_size_ > 0)
+        {
+            const LexerToken& last = this->token_buffer_[
+                (this->token_buffer_start_ + this->token_buffer_size_ - 1) &
+                    (kLookAheadCapacity - 1)];
 
-    if (this->token_buffer_.empty())
-        return LexerToken(this->ConstructToken(LexerTokenType::kUndefined));
+            if (last.type == LexerTokenType::kEOF)
+                return last;
+        }
 
-    return this->token_buffer_.back();
+        this->token_buffer_[
+            (this->token_buffer_start_ + this->token_buffer_size_) &
+                (kLookAheadCapacity - 1)] = this->GenerateToken();
+
+        this->token_buffer_size_++;
+    }
+
+    return this->token_buffer_[
+        (this->token_buffer_start_ + offset - 1) & (kLookAheadCapacity - 1)];
 }
 
 void Lexer::Reset()
 {
-    this->CloseFiles();
     this->file_stack_.clear();
+    this->sources_.clear();
+
+    this->virtual_files_ = nullptr;
+    this->include_files_.clear();
+    this->prefetcher_.reset();
 
-    this->token_buffer_.clear();
+    this->token_buffer_start_ = 0;
+    this->token_buffer_size_  = 0;
 
     this->last_token_ = LexerToken();
 }
 
-std::string Lexer::TokenToString(LexerToken token)
+std::string_view Lexer::GetTokenData(const LexerToken& token) const
+{
+    const SourceLocation& location = token.location;
+
+    if (location.file_id >= this->sources_.size())
+        return std::string_view();
+
+    const char* data =
+        this->sources_[location.file_id].buffer.Begin() + location.offset;
+
+    // Remove the quotes of strings
+    if (token.type == LexerTokenType::kString)
+    {
+        if (location.length < 2)
+            return std::string_view();
+
+        return std::string_view(data + 1, location.length - 2);
+    }
+
+    return std::string_view(data, location.length);
+}
+
+std::string Lexer::GetTokenString(const LexerToken& token) const
 {
+    const std::string_view data = this->GetTokenData(token);
+
+    if (token.type != LexerTokenType::kString)
+        return std::string(data);
+
+    return UnescapeString(data);
+}
+
+std::string Lexer::UnescapeString(std::string_view data)
+{
+    std::string value;
+    value.reserve(data.size());
+
+    for (size_t i = 0; i < data.size(); i++)
+    {
+        // Escaped quotes and backslashes, see scanner::FindStringEnd
+        if (data[i] == '\\' && i + 1 < data.size() &&
+            (data[i + 1] == '"' || data[i + 1] == '\\'))
+        {
+            i++;
+        }
+
+        value += data[i];
+    }
+
+    return value;
+}
+
+ParserPosition Lexer::GetPosition(const SourceLocation& location)
+{
+    if (location.file_id >= this->sources_.size())
+        return ParserPosition({ }, "", 0, 0, 0);
+
+    std::vector<std::string> file_stack;
+    for (uint16_t id = location.file_id; id != kInvalidFileID;
+         id = this->sources_[id].parent_id)
+    {
+        file_stack.insert(file_stack.begin(), this->sources_[id].path);
+    }
+
+    Source& source = this->sources_[location.file_id];
+    this->LoadLineOffsets(source);
+
+    const Vector<uint32_t>& lines = source.line_offsets;
+
+    // The first line always starts at offset 0
+    const size_t line_index = std::upper_bound(
+        lines.begin(), lines.end(), location.offset) - lines.begin() - 1;
+
+    const char* line_start = source.buffer.Begin() + lines[line_index];
+    const char* line_end   = line_index + 1 < lines.size() ?
+        source.buffer.Begin() + lines[line_index + 1] - 1 :
+        source.buffer.End();
+
+    if (line_end > line_start && *(line_end - 1) == '\r')
+        line_end--;
+
+    const size_t start = location.offset - lines[line_index];
+    const size_t end   = start + (location.length ? location.length - 1 : 0);
+
+    return ParserPosition(file_stack, std::string(line_start, line_end),
+                          line_index + 1, start, end);
+}
+
+std::string Lexer::TokenToString(const LexerToken& token) const
+{
+    const std::string data(this->GetTokenData(token));
+
     std::string message = "[";
 
     switch (token.type)
@@ -126,19 +274,19 @@ std::string Lexer::TokenToString(LexerToken token)
         break;
 
     case LexerTokenType::kString:
-        message += "STR=" + token.data;
+        message += "STR=" + data;
         break;
 
     case LexerTokenType::kInt:
-        message += "INT=" + token.data;
+        message += "INT=" + data;
         break;
 
     case LexerTokenType::kFloat:
-        message += "FLOAT=" + token.data;
+        message += "FLOAT=" + data;
         break;
 
     case LexerTokenType::kData:
-        message += "DAT=" + token.data;
+        message += "DAT=" + data;
         break;
 
     case LexerTokenType::kEOF:
@@ -146,62 +294,198 @@ std::string Lexer::TokenToString(LexerToken token)
         break;
 
     default:
-        message += "UND=" + token.data;
+        message += "UND=" + data;
         break;
     }
 
     return message + ']';
 }
 
-/* File */
-Lexer::File::File(std::string path)
-    : path(path)
+void Lexer::ForEachSourceFile(const std::function<
+    void(std::string_view path, std::string_view data)>& function) const
 {
-    this->file.open(this->path);
+    std::unordered_set<std::string_view> paths;
+
+    for (const auto& source : this->sources_)
+    {
+        if (!paths.insert(source.path).second)
+            continue;
+
+        function(source.path, std::string_view(
+            source.buffer.Begin(), source.buffer.Size()));
+    }
 }
 
+/* Source */
+Lexer::Source::Source(std::string path, uint16_t parent_id)
+    : path(path), parent_id(parent_id)
+{ }
+
 /* Lexer */
 void Lexer::OpenFile(std::string path)
 {
-    this->OpenIncludeFile(this->ConstructToken(LexerTokenType::kString, path));
+    this->OpenIncludeFile(path, LexerToken(LexerTokenType::kString, { }));
 }
 
-void Lexer::OpenIncludeFile(LexerToken token)
+void Lexer::OpenIncludeFile(std::string path, LexerToken token)
 {
-    const std::string path = token.data;
+    const uint16_t parent_id = this->file_stack_.empty() ?
+        kInvalidFileID : this->file_stack_.back().id;
 
-    this->file_stack_.emplace_back(
-        File(std::filesystem::absolute(path).string()));
+    Source source(path, parent_id);
 
-    const File& file = this->file_stack_.back();
+    // The main file is scanned directly, included files are
+    // loaded through the include cache
+    if (this->virtual_files_)
+        this->LoadVirtualFile(source, token);
+    else if (this->file_stack_.empty())
+        this->LoadFile(source, token);
+    else
+        this->LoadIncludedFile(source, token);
+
+    this->PushSource(std::move(source), token);
+}
 
-    if (!utils::PathExists(file.path))
+void Lexer::LoadFile(Source& source, LexerToken token) const
+{
+    source.path = AbsolutePath(source.path);
+
+    if (!GetFileIdentity(source.path, source.identity))
     {
-        this->file_stack_.pop_back();
+        if (utils::PathExists(source.path))
+            throw UnableToOpenFile(token);
+
         throw FileNotFound(token);
     }
 
-    if (!this->file_stack_.back().file.is_open())
+    if (!source.buffer.Open(source.path))
+        throw UnableToOpenFile(token);
+}
+
+void Lexer::LoadVirtualFile(Source& source, LexerToken token) const
+{
+    source.path = std::filesystem::path(
+        source.path).lexically_normal().generic_string();
+    source.in_memory = true;
+
+    const auto it = this->virtual_files_->find(source.path);
+    if (it == this->virtual_files_->end())
+        throw FileNotFound(token);
+
+    source.buffer.OpenView(it->second);
+}
+
+void Lexer::LoadIncludedFile(Source& source, LexerToken token)
+{
+    source.path = AbsolutePath(source.path);
+
+    // Files that are included multiple times are only resolved once
+    std::shared_ptr<const CachedFile>& cached_file =
+        this->include_files_[source.path];
+
+    if (!cached_file && this->prefetcher_)
+        cached_file = this->prefetcher_->Wait(source.path);
+
+    if (!cached_file)
+    {
+        FileIdentity identity;
+        if (!GetFileIdentity(source.path, identity))
+        {
+            if (utils::PathExists(source.path))
+                throw UnableToOpenFile(token);
+
+            throw FileNotFound(token);
+        }
+
+        cached_file = IncludeCache::Get().Find(identity);
+        if (!cached_file)
+        {
+            cached_file = this->CacheFile(source.path, identity, token);
+            IncludeCache::Get().Insert(cached_file);
+        }
+    }
+
+    const SourceBuffer& buffer = cached_file->buffer;
+
+    source.identity    = cached_file->identity;
+    source.cached_file = cached_file;
+    source.buffer.OpenView(std::string_view(buffer.Begin(), buffer.Size()));
+}
+
+std::shared_ptr<const CachedFile> Lexer::CacheFile(
+    const std::string& path, const FileIdentity& identity, LexerToken token)
+{
+    std::shared_ptr<CachedFile> file = std::allocate_shared<CachedFile>(
+        MemoryAllocator<CachedFile, MemorySubsystem::kLexer>());
+    file->identity = identity;
+
+    // The file is not mapped, because the cached file is kept alive
+    // while the file might be changed on disk
+    if (!file->buffer.Open(path, false) || file->buffer.Size() > UINT32_MAX)
+        throw UnableToOpenFile(token);
+
+    const SourceBuffer& buffer = file->buffer;
+    this->file_stack_.push_back(
+        { kInvalidFileID, buffer.Begin(), buffer.Begin(), buffer.End() });
+
+    try
+    {
+        while (true)
+        {
+            bool include = false;
+            const LexerToken scanned_token = this->ScanToken(include);
+
+            if (scanned_token.type == LexerTokenType::kEOF)
+                break;
+
+            if (include)
+                file->includes.push_back({ file->tokens.size(), scanned_token });
+            else
+                file->tokens.push_back(scanned_token);
+        }
+    }
+    catch (const LexerException& e)
+    {
+        file->error.emplace(e);
+    }
+
+    this->file_stack_.pop_back();
+
+    return file;
+}
+
+void Lexer::PushSource(Source source, LexerToken token)
+{
+    // Tokens store the file ID and offsets in a compact format
+    if (source.buffer.Size() > UINT32_MAX ||
+        this->sources_.size() >= kInvalidFileID)
     {
-        this->file_stack_.pop_back();
         throw UnableToOpenFile(token);
     }
 
     // Make sure that the file does not include itself
-    for (unsigned int i = 0; i + 1 < this->file_stack_.size(); i++)
+    for (const auto& file : this->file_stack_)
     {
-        if (std::filesystem::equivalent(this->file_stack_[i].path, file.path))
+        const Source& parent = this->sources_[file.id];
+
+        if (parent.in_memory || source.in_memory ?
+                parent.path == source.path :
+                parent.identity.SameFile(source.identity))
         {
-            this->file_stack_.pop_back();
             throw FileIncludesItself(token);
         }
     }
-}
 
-void Lexer::CloseFiles()
-{
-    for (auto& f : this->file_stack_)
-        f.file.close();
+    const uint16_t id = static_cast<uint16_t>(this->sources_.size());
+    this->sources_.push_back(std::move(source));
+
+    const Source& pushed_source = this->sources_.back();
+    const SourceBuffer& buffer = pushed_source.buffer;
+
+    File file = { id, buffer.Begin(), buffer.Begin(), buffer.End() };
+    file.cached_file = pushed_source.cached_file.get();
+
+    this->file_stack_.push_back(file);
 }
 
 void Lexer::RemoveCurrentFile()
@@ -209,7 +493,6 @@ void Lexer::RemoveCurrentFile()
     if (this->file_stack_.empty())
         return;
 
-    this->file_stack_.back().file.close();
     this->file_stack_.pop_back();
 }
 
@@ -220,67 +503,91 @@ bool Lexer::GetNextChar(char& dest)
 
     File& file = this->file_stack_.back();
 
-    if (file.position_in_line >= file.current_line.size())
-    {
-        file.position_in_line = 0;
-        file.line_number++;
+    if (file.cursor >= file.end)
+        return false;
 
-        if (!std::getline(file.file, file.current_line))
-            return false;
+    dest = *file.cursor++;
+
+    return true;
+}
 
-        if (file.current_line.empty())
-            return this->GetNextChar(dest);
+LexerToken Lexer::GenerateToken()
+{
+    while (!this->file_stack_.empty())
+    {
+        File& file = this->file_stack_.back();
 
-        if (file.line_number != 1)
+        if (file.cached_file)
         {
-            dest = '\n';
-            return true;
+            const CachedFile& cached_file = *file.cached_file;
+            const uint16_t id = file.id;
+
+            if (file.next_include < cached_file.includes.size() &&
+                cached_file.includes[file.next_include].token_index ==
+                    file.next_token)
+            {
+                // Opening the file invalidates the reference to the file
+                this->IncludeFile(RelocateToken(
+                    cached_file.includes[file.next_include++].argument, id));
+                continue;
+            }
+
+            if (file.next_token < cached_file.tokens.size())
+                return RelocateToken(cached_file.tokens[file.next_token++], id);
+
+            if (cached_file.error)
+            {
+                const LexerException& error = *cached_file.error;
+                throw LexerException(error.message,
+                                     RelocateToken(error.token, id),
+                                     error.type);
+            }
+
+            this->RemoveCurrentFile();
+            continue;
         }
+
+        bool include = false;
+        const LexerToken token = this->ScanToken(include);
+
+        if (token.type == LexerTokenType::kEOF)
+            this->RemoveCurrentFile();
+        else if (include)
+            this->IncludeFile(token);
+        else
+            return token;
     }
 
-    dest = file.current_line[file.position_in_line++];
+    // The end of file is located at the end of the main file
+    SourceLocation location;
+    if (!this->sources_.empty())
+    {
+        location.offset  = this->sources_[0].buffer.Size();
+        location.file_id = 0;
+    }
 
-    return true;
+    return LexerToken(LexerTokenType::kEOF, location);
 }
 
-char Lexer::GetCurrentChar(size_t offset) const
+LexerToken Lexer::ScanToken(bool& include)
 {
-    if (this->file_stack_.empty())
-        return 0;
-
-    const File& file = this->file_stack_.back();
-
-    if (file.position_in_line + offset - 1 < 0)
-        return 0;
-    if (file.position_in_line + offset - 1 >= file.current_line.size())
-        return 0;
+    File& file = this->file_stack_.back();
 
-    return file.current_line[file.position_in_line + offset - 1];
-}
+    file.cursor = scanner::SkipWhitespaceAndComments(file.cursor, file.end);
 
-LexerToken Lexer::GenerateToken()
-{
     char c;
     if (!this->GetNextChar(c))
     {
-        this->RemoveCurrentFile();
-
-        if (this->file_stack_.empty())
-            return this->ConstructToken(LexerTokenType::kEOF);
+        SourceLocation location;
+        location.offset  = static_cast<uint32_t>(file.end - file.begin);
+        location.file_id = file.id;
 
-        return this->GenerateToken();
+        return LexerToken(LexerTokenType::kEOF, location);
     }
 
-    std::string temp_buffer;
+    size_t bool_length = 0;
 
-    if (std::isspace(c))
-        return this->GenerateToken();
-    else if (this->IsComment())
-    {
-        this->SkipComment();
-        return this->GenerateToken();
-    }
-    else if(c == ':')
+    if(c == ':')
         return this->ConstructToken(LexerTokenType::kColon);
     else if(c == ',')
         return this->ConstructToken(LexerTokenType::kComma);
@@ -295,257 +602,203 @@ LexerToken Lexer::GenerateToken()
     else if(c == '}')
         return this->ConstructToken(LexerTokenType::kCBracketClose);
     else if (c == '@')
+    {
+        include = true;
         return this->ProcessLexerInstruction();
+    }
     else if(c == '"')
         return this->CreateString();
-    else if (std::isdigit(c) || c == '-')
+    else if (scanner::IsDigit(c) || c == '-')
         return this->CreateNumber();
-    else if (this->IsBool(temp_buffer))
-        return this->CreateBool(temp_buffer);
-    else if (std::isalpha(c) || std::isdigit(c) || c == '_' || c == '.')
+    else if (this->IsBool(bool_length))
+        return this->CreateBool(bool_length);
+    else if (scanner::IsDataChar(c))
         return this->CreateData();
     else
-        throw InvalidSymbol(this->ConstructToken(LexerTokenType::kUndefined,
-                                std::string(1, c)));
-
-    return this->ConstructToken(LexerTokenType::kUndefined);
+        throw InvalidSymbol(
+            this->ConstructToken(LexerTokenType::kUndefined));
 }
 
-bool Lexer::IsComment() const
+LexerToken Lexer::CreateString()
 {
-    if (this->file_stack_.empty())
-        return false;
-
-    const File& file = this->file_stack_.back();
+    File& file = this->file_stack_.back();
+    const size_t start = this->GetCurrentPosition();
 
-    if (this->GetCurrentChar() == '#')
-        return true;
+    file.cursor = scanner::FindStringEnd(file.cursor, file.end);
 
-    if (this->GetCurrentChar()   == '/' &&
-        (this->GetCurrentChar(1) == '/' || this->GetCurrentChar(1) == '*'))
+    if (file.cursor >= file.end)
     {
-        return true;
+        throw UnexpectedEndOfString(this->ConstructToken(
+            LexerTokenType::kString, start, this->GetCurrentPosition()));
     }
 
-    return false;
+    file.cursor++;
+
+    return this->ConstructToken(LexerTokenType::kString,
+                                start, this->GetCurrentPosition());
 }
 
-void Lexer::SkipComment()
+LexerToken Lexer::CreateNumber()
 {
-    bool multiline = false;
+    File& file = this->file_stack_.back();
 
-    if (this->GetCurrentChar() == '/' && this->GetCurrentChar(1) == '*')
-        multiline = true;
+    const char* start = file.cursor - 1;
+    file.cursor = scanner::SkipNumberChars(file.cursor, file.end);
 
-    char c;
-    while (this->GetNextChar(c))
-    {
-        if (!multiline && c == '\n')
-            return;
+    const std::string_view data(start, file.cursor - start);
 
-        if (multiline && c == '/' && this->GetCurrentChar(-1) == '*')
-            return;
-    }
-}
+    const LexerTokenType type = data.find('.') != data.npos ?
+        LexerTokenType::kFloat : LexerTokenType::kInt;
 
-LexerToken Lexer::CreateString()
-{
-    std::string value;
-    size_t start_pos = this->GetCurrentPosition();
+    LexerToken token = this->ConstructToken(type, start - file.begin,
+                                            this->GetCurrentPosition());
 
-    char c;
-    while (this->GetNextChar(c))
-    {
-        if (c == '"' && this->GetCurrentChar(-1) != '\\')
-        {
-            return this->ConstructToken(LexerTokenType::kString, value,
-                                        start_pos, this->GetCurrentPosition());
-        }
-        if (c == '\\' && this->GetCurrentChar(1) == '"')
-            continue;
+    size_t length = 0;
+    const bool converted = type == LexerTokenType::kFloat ?
+        utils::StringToFloat(data, &token.float_value, &length) :
+        utils::StringToInt(data, &token.int_value, &length);
 
-        value += c;
+    if (!converted)
+    {
+        throw NumberConversionError(
+            type == LexerTokenType::kFloat ? "Float" : "Int",
+            std::string(data), token);
     }
 
-    throw UnexpectedEndOfString(
-        this->ConstructToken(LexerTokenType::kString, value,
-                             start_pos, this->GetCurrentPosition()));
+    // The entire token has to be a valid number, e.g. "1.2.3" is not
+    if (length != data.size())
+        throw InvalidNumber(token);
+
+    return token;
 }
 
-LexerToken Lexer::CreateNumber()
+bool Lexer::IsBool(size_t& length) const
 {
-    std::string value;
-    value += this->GetCurrentChar();
+    static const std::string_view values[] = { "true", "false" };
 
-    size_t start_pos = this->GetCurrentPosition();
-    size_t dot_count = 0;
+    const File& file = this->file_stack_.back();
 
-    // Single digit numbers
-    if (!isdigit(this->GetCurrentChar(1)) && this->GetCurrentChar(1) != '.')
-    {
-        return this->ConstructToken(LexerTokenType::kInt, value,
-                                start_pos, this->GetCurrentPosition());
-    }
+    // The first char of the value was already processed
+    const char* start = file.cursor - 1;
+    const size_t size = file.end - start;
 
-    char c;
-    while (this->GetNextChar(c))
+    for (const auto& value : values)
     {
-        if (this->IsComment())
+        if (size < value.size() ||
+            std::string_view(start, value.size()) != value)
         {
-            this->SkipComment();
-            break;
+            continue;
         }
 
-        if (c == '.')
-            dot_count++;
-
-        value += c;
-
-        const char next_char = this->GetCurrentChar(1);
-        if (!isdigit(next_char) && next_char != '.')
-            break;
-    }
-
-    if (dot_count >= 1)
-    {
-        return this->ConstructToken(LexerTokenType::kFloat, value,
-                                start_pos, this->GetCurrentPosition());
-    }
-
-    return this->ConstructToken(LexerTokenType::kInt, value,
-                            start_pos, this->GetCurrentPosition());
-}
-
-bool Lexer::IsBool(std::string& value_out) const
-{
-    std::string value;
-    for (unsigned int i = 0; i < 4; i++)
-        value += this->GetCurrentChar(i);
-
-    value_out = value;
+        // Data that only starts with a bool value is not a bool
+        if (size > value.size() && scanner::IsDataChar(start[value.size()]))
+            continue;
 
-    if (value == "true")
+        length = value.size();
         return true;
+    }
 
-    value += this->GetCurrentChar(4);
-    value_out = value;
-
-    if (value == "false")
-        return true;
     return false;
 }
 
-LexerToken Lexer::CreateBool(std::string value)
+LexerToken Lexer::CreateBool(size_t length)
 {
-    LexerToken token = this->ConstructToken(LexerTokenType::kBool, value);
-
-    token.position.end = token.position.start + value.size();
+    const size_t start = this->GetCurrentPosition();
 
+    // The first char of the value was already processed
     File& file = this->file_stack_.back();
+    file.cursor += length - 1;
 
-    file.position_in_line += value.size();
-
-    return token;
+    return this->ConstructToken(LexerTokenType::kBool,
+                                start, this->GetCurrentPosition());
 }
 
 LexerToken Lexer::CreateData()
 {
-    std::string value;
-    value += this->GetCurrentChar();
+    File& file = this->file_stack_.back();
 
-    size_t start_pos = this->GetCurrentPosition();
+    const char* start = file.cursor - 1;
+    file.cursor = scanner::SkipDataChars(file.cursor, file.end);
 
-    char c;
-    while (this->GetNextChar(c))
-    {
-        if (this->IsComment())
-        {
-            this->SkipComment();
-            break;
-        }
+    LexerToken token = this->ConstructToken(LexerTokenType::kData,
+                                            start - file.begin,
+                                            this->GetCurrentPosition());
 
-        value += c;
+    const std::string_view data(start, file.cursor - start);
+    if (data.find('.') == data.npos)
+        token.atom = Atom(data);
 
-        const char next_char = this->GetCurrentChar(1);
-        if (!std::isalpha(next_char) && !std::isdigit(next_char) &&
-            next_char != '_' && next_char != '.')
-        {
-            break;
-        }
-    }
-
-    return this->ConstructToken(LexerTokenType::kData, value,
-                                start_pos, this->GetCurrentPosition());
+    return token;
 }
 
 LexerToken Lexer::ProcessLexerInstruction()
 {
-    std::string instruction;
-    const size_t start = this->GetCurrentPosition() - 1;
+    File& file = this->file_stack_.back();
 
-    char c;
-    while (this->GetNextChar(c))
-    {
-        if (std::isspace(c))
-            break;
+    const size_t start = this->GetCurrentPosition();
 
-        instruction += c;
+    const char* instruction_end = file.cursor;
+    while (instruction_end < file.end &&
+           !scanner::IsWhitespace(*instruction_end))
+    {
+        instruction_end++;
     }
 
+    const std::string_view instruction(
+        file.cursor, instruction_end - file.cursor);
+
+    file.cursor = instruction_end;
+
     if (instruction == "include")
         return this->ProcessIncludeInstruction();
 
-    throw UnknownLexerInstruction(this->ConstructToken(LexerTokenType::kString,
-                    instruction, start,  this->GetCurrentPosition()));
+    throw UnknownLexerInstruction(this->ConstructToken(
+        LexerTokenType::kString, start, this->GetCurrentPosition()));
 }
 
 LexerToken Lexer::ProcessIncludeInstruction()
 {
-    LexerToken arg = this->GenerateToken();
+    bool include = false;
+    const LexerToken argument = this->ScanToken(include);
 
-    if (arg.type != LexerTokenType::kString)
-        throw WrongIncludeArgument(arg);
+    if (argument.type != LexerTokenType::kString || include)
+        throw WrongIncludeArgument(argument);
 
-    arg.data = this->GetCurrentDirectory() + '/' + arg.data;
+    return argument;
+}
 
-    this->OpenIncludeFile(arg);
+void Lexer::IncludeFile(const LexerToken& argument)
+{
+    // In-memory data has no directory, its includes are relative
+    // to the working directory or the root of the virtual filesystem
+    const std::string directory = this->GetCurrentDirectory();
+    const std::string path      = this->GetTokenString(argument);
 
-    return this->GenerateToken();
+    this->OpenIncludeFile(
+        directory.empty() ? path : directory + '/' + path, argument);
 }
 
 LexerToken Lexer::ConstructToken(LexerTokenType type) const
 {
-    return this->ConstructToken(type, "");
-}
+    const size_t position = this->GetCurrentPosition();
 
-LexerToken Lexer::ConstructToken(LexerTokenType type, std::string data) const
-{
-    return this->ConstructToken(type, data,
-        this->GetCurrentPosition(), this->GetCurrentPosition() + 1);
+    return this->ConstructToken(type, position, position);
 }
 
-LexerToken Lexer::ConstructToken(LexerTokenType type, std::string data,
+LexerToken Lexer::ConstructToken(LexerTokenType type,
                                  size_t start, size_t end) const
 {
     if (this->file_stack_.empty())
-        return LexerToken(type, ParserPosition({ }, "", 0, start, end), data);
-
-    const File& file = this->file_stack_.back();
+        return LexerToken(type, SourceLocation());
 
-    return LexerToken(type, ParserPosition(this->ConvertFileStack(),
-                               file.current_line, file.line_number, start, end),
-                      data);
-}
+    SourceLocation location;
+    location.offset  = static_cast<uint32_t>(start);
+    location.length  = end >= start ? static_cast<uint32_t>(end - start + 1) : 0;
+    location.file_id = this->file_stack_.back().id;
 
-std::vector<std::string> Lexer::ConvertFileStack() const
-{
-    std::vector<std::string> result;
-    for (const auto& file : this->file_stack_)
-        result.push_back(file.path);
-    return result;
+    return LexerToken(type, location);
 }
 
-
 size_t Lexer::GetCurrentPosition() const
 {
     if (this->file_stack_.empty())
@@ -553,7 +806,24 @@ size_t Lexer::GetCurrentPosition() const
 
     const File& file = this->file_stack_.back();
 
-    return file.position_in_line == 0 ? 0 : file.position_in_line - 1;
+    return file.cursor == file.begin ? 0 : file.cursor - file.begin - 1;
+}
+
+void Lexer::LoadLineOffsets(Source& source) const
+{
+    if (!source.line_offsets.empty())
+        return;
+
+    source.line_offsets.push_back(0);
+
+    const char* begin = source.buffer.Begin();
+    const char* end   = source.buffer.End();
+
+    for (const char* c = begin; c < end; c++)
+    {
+        if (*c == '\n')
+            source.line_offsets.push_back(static_cast<uint32_t>(c - begin + 1));
+    }
 }
 
 std::string Lexer::GetCurrentDirectory() const
@@ -562,7 +832,7 @@ std::string Lexer::GetCurrentDirectory() const
         return std::string();
 
     return std::filesystem::path(
-        this->file_stack_.back().path).parent_path().string();
+        this->sources_[this->file_stack_.back().id].path).parent_path().string();
 }
 
 }  // namespace imgui_markup::internal::parser
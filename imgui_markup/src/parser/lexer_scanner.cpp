@@ -0,0 +1,236 @@
+#include "impch.h"
+#include "parser/lexer_scanner.h"
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+    #define IMGUI_MARKUP_SCANNER_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || \
+      (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define IMGUI_MARKUP_SCANNER_SSE2
+#endif
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif  // _MSC_VER
+
+namespace imgui_markup::internal::parser::scanner
+{
+
+namespace
+{
+
+#if defined(IMGUI_MARKUP_SCANNER_AVX2) || defined(IMGUI_MARKUP_SCANNER_SSE2)
+
+/**
+ * Thin wrapper above the vector instructions, so that the kernels
+ * can be written once for SSE2 and AVX2.
+ */
+#if defined(IMGUI_MARKUP_SCANNER_AVX2)
+using Vector = __m256i;
+constexpr size_t kVectorSize = 32;
+
+inline Vector   Load(const char* c)       { return _mm256_loadu_si256(
+                                                reinterpret_cast<const __m256i*>(c)); }
+inline Vector   Set(char c)               { return _mm256_set1_epi8(c);  }
+inline Vector   Equal(Vector a, Vector b) { return _mm256_cmpeq_epi8(a, b); }
+inline Vector   Greater(Vector a, Vector b) { return _mm256_cmpgt_epi8(a, b); }
+inline Vector   And(Vector a, Vector b)   { return _mm256_and_si256(a, b); }
+inline Vector   Or(Vector a, Vector b)    { return _mm256_or_si256(a, b);  }
+inline uint32_t Mask(Vector v)
+    { return static_cast<uint32_t>(_mm256_movemask_epi8(v)); }
+constexpr uint32_t kFullMask = 0xFFFFFFFF;
+#else
+using Vector = __m128i;
+constexpr size_t kVectorSize = 16;
+
+inline Vector   Load(const char* c)       { return _mm_loadu_si128(
+                                                reinterpret_cast<const __m128i*>(c)); }
+inline Vector   Set(char c)               { return _mm_set1_epi8(c);  }
+inline Vector   Equal(Vector a, Vector b) { return _mm_cmpeq_epi8(a, b); }
+inline Vector   Greater(Vector a, Vector b) { return _mm_cmpgt_epi8(a, b); }
+inline Vector   And(Vector a, Vector b)   { return _mm_and_si128(a, b); }
+inline Vector   Or(Vector a, Vector b)    { return _mm_or_si128(a, b);  }
+inline uint32_t Mask(Vector v)
+    { return static_cast<uint32_t>(_mm_movemask_epi8(v)); }
+constexpr uint32_t kFullMask = 0xFFFF;
+#endif  // IMGUI_MARKUP_SCANNER_AVX2
+
+inline unsigned int CountTrailingZeros(uint32_t mask)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return index;
+#else
+    return __builtin_ctz(mask);
+#endif  // _MSC_VER
+}
+
+/**
+ * Checks if first < c < last for every byte.
+ * Bytes above 0x7F are negative and never inside an ASCII range.
+ */
+inline Vector InRange(Vector v, char first, char last)
+{
+    return And(Greater(v, Set(first - 1)), Greater(Set(last + 1), v));
+}
+
+inline Vector WhitespaceMask(Vector v)
+{
+    return Or(Equal(v, Set(' ')), InRange(v, '\t', '\r'));
+}
+
+inline Vector NumberCharMask(Vector v)
+{
+    return Or(InRange(v, '0', '9'), Equal(v, Set('.')));
+}
+
+inline Vector DataCharMask(Vector v)
+{
+    // Setting bit 0x20 converts upper case to lower case letters
+    const Vector lower = Or(v, Set(0x20));
+
+    return Or(Or(InRange(lower, 'a', 'z'), NumberCharMask(v)),
+              Equal(v, Set('_')));
+}
+
+/**
+ * Skips every character as long as the vector mask is set and the
+ * scalar class matches.
+ */
+template<typename VectorMask>
+inline const char* SkipWhile(const char* cursor, const char* end,
+                             VectorMask vector_mask, CharClass char_class)
+{
+    while (static_cast<size_t>(end - cursor) >= kVectorSize)
+    {
+        const uint32_t mask = ~Mask(vector_mask(Load(cursor))) & kFullMask;
+        if (mask)
+            return cursor + CountTrailingZeros(mask);
+
+        cursor += kVectorSize;
+    }
+
+    while (cursor < end && HasClass(*cursor, char_class))
+        cursor++;
+
+    return cursor;
+}
+
+#else
+
+template<typename VectorMask>
+inline const char* SkipWhile(const char* cursor, const char* end,
+                             VectorMask, CharClass char_class)
+{
+    while (cursor < end && HasClass(*cursor, char_class))
+        cursor++;
+
+    return cursor;
+}
+
+constexpr int WhitespaceMask = 0;
+constexpr int NumberCharMask = 0;
+constexpr int DataCharMask   = 0;
+
+#endif  // IMGUI_MARKUP_SCANNER_AVX2 || IMGUI_MARKUP_SCANNER_SSE2
+
+}  // namespace
+
+const char* SkipWhitespaceAndComments(const char* cursor, const char* end)
+{
+    while (true)
+    {
+        cursor = SkipWhile(cursor, end, WhitespaceMask, kWhitespace);
+
+        if (cursor >= end)
+            return end;
+
+        const char next = cursor + 1 < end ? cursor[1] : 0;
+
+        if (*cursor == '#' || (*cursor == '/' && next == '/'))
+        {
+            cursor = FindChar(cursor, end, '\n');
+            continue;
+        }
+
+        if (*cursor == '/' && next == '*')
+        {
+            cursor += 2;
+            while (true)
+            {
+                cursor = FindChar(cursor, end, '*');
+                if (cursor >= end)
+                    return end;
+
+                cursor++;
+                if (cursor < end && *cursor == '/')
+                    break;
+            }
+
+            cursor++;
+            continue;
+        }
+
+        return cursor;
+    }
+}
+
+const char* SkipDataChars(const char* cursor, const char* end)
+{
+    return SkipWhile(cursor, end, DataCharMask, kDataChar);
+}
+
+const char* SkipNumberChars(const char* cursor, const char* end)
+{
+    return SkipWhile(cursor, end, NumberCharMask, kNumberChar);
+}
+
+const char* FindChar(const char* cursor, const char* end, char c)
+{
+#if defined(IMGUI_MARKUP_SCANNER_AVX2) || defined(IMGUI_MARKUP_SCANNER_SSE2)
+    const Vector pattern = Set(c);
+
+    while (static_cast<size_t>(end - cursor) >= kVectorSize)
+    {
+        const uint32_t mask = Mask(Equal(Load(cursor), pattern));
+        if (mask)
+            return cursor + CountTrailingZeros(mask);
+
+        cursor += kVectorSize;
+    }
+#endif  // IMGUI_MARKUP_SCANNER_AVX2 || IMGUI_MARKUP_SCANNER_SSE2
+
+    while (cursor < end && *cursor != c)
+        cursor++;
+
+    return cursor;
+}
+
+const char* FindStringEnd(const char* cursor, const char* end)
+{
+    const char* begin = cursor;
+
+    while (true)
+    {
+        cursor = FindChar(cursor, end, '"');
+        if (cursor >= end)
+            return end;
+
+        // The quote is escaped by an odd number of backslashes
+        size_t backslashes = 0;
+        while (cursor - backslashes > begin &&
+               *(cursor - backslashes - 1) == '\\')
+        {
+            backslashes++;
+        }
+
+        if (backslashes % 2 == 0)
+            return cursor;
+
+        cursor++;
+    }
+}
+
+}  // namespace imgui_markup::internal::parser::scanner
@@ -0,0 +1,103 @@
+#ifndef IMGUI_MARKUP_SRC_PARSER_LEXER_SCANNER_H_
+#define IMGUI_MARKUP_SRC_PARSER_LEXER_SCANNER_H_
+
+#include <array>
+#include <cstdint>
+
+namespace imgui_markup::internal::parser::scanner
+{
+
+/**
+ * Classes of a character, used as bit flags inside the class table.
+ */
+enum CharClass : uint8_t
+{
+    kWhitespace = 1 << 0,  // ' ', '\t', '\n', '\v', '\f', '\r'
+    kDigit      = 1 << 1,  // 0-9
+    kAlpha      = 1 << 2,  // a-z, A-Z
+    kDataChar   = 1 << 3,  // a-z, A-Z, 0-9, '_', '.'
+    kNumberChar = 1 << 4   // 0-9, '.'
+};
+
+constexpr std::array<uint8_t, 256> CreateCharClassTable()
+{
+    std::array<uint8_t, 256> table = { };
+
+    for (unsigned int c = 0; c < 256; c++)
+    {
+        uint8_t flags = 0;
+
+        if (c == ' ' || (c >= '\t' && c <= '\r'))
+            flags |= kWhitespace;
+        if (c >= '0' && c <= '9')
+            flags |= kDigit | kDataChar | kNumberChar;
+        if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'))
+            flags |= kAlpha | kDataChar;
+        if (c == '_')
+            flags |= kDataChar;
+        if (c == '.')
+            flags |= kDataChar | kNumberChar;
+
+        table[c] = flags;
+    }
+
+    return table;
+}
+
+/**
+ * Lookup table containing the CharClass flags of every character.
+ * Used instead of the locale dependent std::isspace, std::isalpha, etc.
+ */
+inline constexpr std::array<uint8_t, 256> kCharClassTable =
+    CreateCharClassTable();
+
+inline bool HasClass(char c, CharClass char_class)
+{
+    return kCharClassTable[static_cast<unsigned char>(c)] & char_class;
+}
+
+inline bool IsWhitespace(char c) { return HasClass(c, kWhitespace); }
+inline bool IsDigit(char c)      { return HasClass(c, kDigit);      }
+inline bool IsAlpha(char c)      { return HasClass(c, kAlpha);      }
+inline bool IsDataChar(char c)   { return HasClass(c, kDataChar);   }
+inline bool IsNumberChar(char c) { return HasClass(c, kNumberChar); }
+
+/**
+ * The following functions process multiple bytes at once if SSE2 or AVX2
+ * is available and fall back to the class table otherwise.
+ * Every function returns a pointer to the first character that was not
+ * skipped, or end if every character was skipped.
+ */
+
+/**
+ * Skips whitespaces, line comments ('#' and "//") and block comments.
+ * Line comments end before the line break, unterminated block comments
+ * end at the end of the buffer.
+ */
+const char* SkipWhitespaceAndComments(const char* cursor, const char* end);
+
+/**
+ * Skips every character that is part of a data token (see kDataChar).
+ */
+const char* SkipDataChars(const char* cursor, const char* end);
+
+/**
+ * Skips every character that is part of a number token (see kNumberChar).
+ */
+const char* SkipNumberChars(const char* cursor, const char* end);
+
+/**
+ * Finds the first occurrence of the given character.
+ */
+const char* FindChar(const char* cursor, const char* end, char c);
+
+/**
+ * Finds the closing quote of a string, starting after the opening quote.
+ * A backslash escapes a quote or another backslash, so "dir\\" ends after
+ * the second backslash.
+ */
+const char* FindStringEnd(const char* cursor, const char* end);
+
+}  // namespace imgui_markup::internal::parser::scanner
+
+#endif  // IMGUI_MARKUP_SRC_PARSER_LEXER_SCANNER_H_
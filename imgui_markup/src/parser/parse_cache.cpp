@@ -0,0 +1,224 @@
+#include "impch.h"
+#include "parser/parse_cache.h"
+
+#include "imgui_markup/parser/source_buffer.h"
+#include "utility/utility.h"
+
+#include <cstdio>
+#include <thread>
+
+namespace imgui_markup::internal::parser
+{
+
+namespace fs = std::filesystem;
+
+namespace
+{
+
+constexpr char kEntryExtension[] = ".illc";
+
+}  // namespace
+
+ParseCache& ParseCache::Get()
+{
+    static ParseCache cache;
+    return cache;
+}
+
+void ParseCache::Enable(const std::string& directory, uint64_t max_size)
+{
+    std::lock_guard<std::mutex> lock(this->mutex_);
+
+    std::error_code error;
+    fs::create_directories(directory, error);
+
+    this->directory_ = directory;
+    this->max_size_  = max_size;
+    this->enabled_   = true;
+
+    // The maximum size might be smaller than the last time
+    this->Evict(this->directory_, this->max_size_);
+}
+
+void ParseCache::Disable()
+{
+    std::lock_guard<std::mutex> lock(this->mutex_);
+
+    this->enabled_ = false;
+}
+
+bool ParseCache::Load(const std::string& path, GlobalObject& dest)
+{
+    std::string absolute_path;
+    std::string entry_path;
+    if (!this->GetEntryPath(path, absolute_path, entry_path))
+        return false;
+
+    CompiledFile compiled_file;
+    const ParserResult result = compiled_file.Load(entry_path, dest,
+        [&absolute_path](const std::vector<CompiledSource>& sources)
+        { return SourcesUnchanged(sources, absolute_path); });
+
+    if (!result)
+    {
+        this->misses_++;
+        return false;
+    }
+
+    // The modification time of an entry is the time it was last used
+    std::error_code error;
+    fs::last_write_time(entry_path, fs::file_time_type::clock::now(), error);
+
+    this->hits_++;
+    return true;
+}
+
+void ParseCache::Store(const std::string& path, const Lexer& lexer,
+                       const GlobalObject& source)
+{
+    std::string absolute_path;
+    std::string entry_path;
+    if (!this->GetEntryPath(path, absolute_path, entry_path))
+        return;
+
+    std::vector<CompiledSource> sources;
+    lexer.ForEachSourceFile(
+        [&sources](std::string_view path, std::string_view data)
+        {
+            sources.push_back({ std::string(path), data.size(),
+                                utils::HashData(data) });
+        });
+
+    if (sources.empty() || sources.front().path != absolute_path)
+        return;
+
+    std::lock_guard<std::mutex> lock(this->mutex_);
+
+    // The entry is written to a temporary file first, so that other
+    // processes never load a partially written entry
+    const std::string temporary_path = entry_path + '.' + std::to_string(
+        std::hash<std::thread::id>()(std::this_thread::get_id())) + ".tmp";
+
+    CompiledFile compiled_file;
+    if (!compiled_file.Write(source, temporary_path, sources))
+    {
+        std::remove(temporary_path.c_str());
+        return;
+    }
+
+    std::error_code error;
+    fs::rename(temporary_path, entry_path, error);
+    if (error)
+    {
+        std::remove(temporary_path.c_str());
+        return;
+    }
+
+    this->writes_++;
+
+    this->Evict(this->directory_, this->max_size_);
+}
+
+ParseCacheStatistics ParseCache::GetStatistics() const
+{
+    ParseCacheStatistics statistics;
+    statistics.hits      = this->hits_;
+    statistics.misses    = this->misses_;
+    statistics.writes    = this->writes_;
+    statistics.evictions = this->evictions_;
+
+    return statistics;
+}
+
+bool ParseCache::GetEntryPath(const std::string& path,
+                              std::string& absolute_path, std::string& dest)
+{
+    std::error_code error;
+    absolute_path = fs::absolute(path, error).string();
+    if (error)
+        return false;
+
+    char name[17];
+    std::snprintf(name, sizeof(name), "%016llx",
+        static_cast<unsigned long long>(utils::HashData(absolute_path)));
+
+    std::lock_guard<std::mutex> lock(this->mutex_);
+
+    if (!this->enabled_)
+        return false;
+
+    dest = (fs::path(this->directory_) / name).string() + kEntryExtension;
+    return true;
+}
+
+void ParseCache::Evict(const std::string& directory, uint64_t max_size)
+{
+    struct Entry
+    {
+        fs::path path;
+        fs::file_time_type time;
+        uint64_t size;
+    };
+
+    std::vector<Entry> entries;
+    uint64_t total_size = 0;
+
+    std::error_code error;
+    for (const auto& file : fs::directory_iterator(directory, error))
+    {
+        if (file.path().extension() != kEntryExtension)
+            continue;
+
+        Entry entry;
+        entry.path = file.path();
+        entry.time = file.last_write_time(error);
+        entry.size = file.file_size(error);
+        if (error)
+            continue;
+
+        total_size += entry.size;
+        entries.push_back(std::move(entry));
+    }
+
+    if (total_size <= max_size)
+        return;
+
+    std::sort(entries.begin(), entries.end(),
+        [](const Entry& left, const Entry& right)
+        { return left.time < right.time; });
+
+    for (const auto& entry : entries)
+    {
+        if (total_size <= max_size)
+            break;
+
+        if (!fs::remove(entry.path, error))
+            continue;
+
+        total_size -= entry.size;
+        this->evictions_++;
+    }
+}
+
+bool ParseCache::SourcesUnchanged(const std::vector<CompiledSource>& sources,
+                                  const std::string& absolute_path)
+{
+    // Different paths can have the same hash
+    if (sources.empty() || sources.front().path != absolute_path)
+        return false;
+
+    for (const auto& source : sources)
+    {
+        SourceBuffer buffer;
+        if (!buffer.Open(source.path) || buffer.Size() != source.size)
+            return false;
+
+        const std::string_view data(buffer.Begin(), buffer.Size());
+        if (utils::HashData(data) != source.hash)
+            return false;
+    }
+
+    return true;
+}
+
+}  // namespace imgui_markup::internal::parser
@@ -0,0 +1,114 @@
+#ifndef IMGUI_MARKUP_SRC_PARSER_PARSE_CACHE_H_
+#define IMGUI_MARKUP_SRC_PARSER_PARSE_CACHE_H_
+
+#include "imgui_markup/parser/lexer.h"
+#include "imgui_markup/parser/parse_cache_statistics.h"
+#include "imgui_markup/objects/global_object.h"
+#include "parser/compiled_file.h"
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace imgui_markup::internal::parser
+{
+
+/**
+ * Process wide, opt-in cache of parsed files on disk.
+ * The object tree of every file that was parsed successfully is stored as
+ * a compiled file inside the cache directory, together with the path,
+ * size and content hash of the file and every file it includes.
+ * Parsing the file again loads the compiled file instead, as long as
+ * none of those files changed.
+ *
+ * There is one entry per main file, named after the hash of its absolute
+ * path. The size of the directory is limited by removing the least
+ * recently used entries, which is tracked through the modification time
+ * of the entries, so the order is kept across processes.
+ * The cache is thread safe.
+ */
+class ParseCache
+{
+public:
+    static ParseCache& Get();
+
+    /**
+     * Enables the cache. The directory is created if it does not exist.
+     *
+     * @param directory - Directory containing the cache entries.
+     * @param max_size  - Maximum size of every entry combined, in bytes.
+     */
+    void Enable(const std::string& directory, uint64_t max_size);
+
+    /**
+     * Disables the cache. The entries stay on disk.
+     */
+    void Disable();
+
+    inline bool IsEnabled() const { return this->enabled_; }
+
+    /**
+     * Loads the object tree of a file from the cache.
+     *
+     * @param path - Path of the main file, as passed to the parser.
+     * @param dest - Global object receiving the object tree.
+     * @return true if the object tree was loaded, false if the file is not
+     *         cached or one of its files changed. The global object is
+     *         empty in that case.
+     */
+    bool Load(const std::string& path, GlobalObject& dest);
+
+    /**
+     * Stores the object tree of a file that was parsed successfully.
+     * Errors are ignored, because the file can always be parsed again.
+     *
+     * @param path   - Path of the main file, as passed to the parser.
+     * @param lexer  - Lexer that loaded the file and every included file.
+     * @param source - Object tree that was generated from the files.
+     */
+    void Store(const std::string& path, const Lexer& lexer,
+               const GlobalObject& source);
+
+    ParseCacheStatistics GetStatistics() const;
+
+private:
+    ParseCache() = default;
+
+    std::mutex mutex_;
+    std::string directory_;
+    uint64_t max_size_ = 0;
+    std::atomic<bool> enabled_ = false;
+
+    std::atomic<uint64_t> hits_      = 0;
+    std::atomic<uint64_t> misses_    = 0;
+    std::atomic<uint64_t> writes_    = 0;
+    std::atomic<uint64_t> evictions_ = 0;
+
+    /**
+     * Gets the path of the cache entry of a file.
+     *
+     * @param path          - Path of the main file.
+     * @param absolute_path - Receives the absolute path of the main file.
+     * @return false if the cache is disabled or the path is invalid.
+     */
+    bool GetEntryPath(const std::string& path, std::string& absolute_path,
+                      std::string& dest);
+
+    /**
+     * Removes the least recently used entries, until the size of the
+     * directory is below the maximum size.
+     */
+    void Evict(const std::string& directory, uint64_t max_size);
+
+    /**
+     * Checks if the files of an entry still have the same content.
+     */
+    static bool SourcesUnchanged(const std::vector<CompiledSource>& sources,
+                                 const std::string& absolute_path);
+};
+
+}  // namespace imgui_markup::internal::parser
+
+#endif  // IMGUI_MARKUP_SRC_PARSER_PARSE_CACHE_H_
@@ -1,66 +1,157 @@
 #include "impch.h"
 #include "imgui_markup/parser/parser.h"
 
+#include "parser/parse_cache.h"
+
 #include <iostream>
 
 namespace imgui_markup::internal::parser
 {
 
 /* Parser */
+Parser::Parser(ParserMode mode)
+    : mode_(mode)
+{ }
+
 ParserResult Parser::ParseFile(const std::string file, GlobalObject& dest)
+{
+    ParseCache& cache = ParseCache::Get();
+
+    if (cache.IsEnabled() && cache.Load(file, dest))
+        return ParserResult(ParserResultType::kSuccess);
+
+    const ParserResult result =
+        this->Parse([&]() { this->lexer_.InitFile(file); }, dest);
+
+    // The files are still loaded by the lexer, so they do not have to be
+    // read again to hash them
+    if (result && cache.IsEnabled())
+        cache.Store(file, this->lexer_, dest);
+
+    return result;
+}
+
+ParserResult Parser::ParseData(std::string_view data, GlobalObject& dest)
+{
+    return this->Parse([&]() { this->lexer_.InitData(data); }, dest);
+}
+
+ParserResult Parser::ParseBuffers(const std::string file,
+                                  const VirtualFileSystem& files,
+                                  GlobalObject& dest)
+{
+    return this->Parse(
+        [&]() { this->lexer_.InitVirtualFile(file, files); }, dest);
+}
+
+ParserResult Parser::Parse(const std::function<void()>& init_lexer,
+                           GlobalObject& dest)
 {
     this->Reset();
 
+    ParserResult result(ParserResultType::kSuccess);
+
     try
     {
         dest.Reset();
 
-        this->lexer_.InitFile(file);
+        init_lexer();
 
-        std::shared_ptr<ParserNode> root_node = std::make_shared<ParserNode>(
-            ParserNodeType::kRootNode, ParserPosition({file}, "", 0, 0, 0));
+        ParserNode root_node(ParserNodeType::kRootNode, SourceLocation());
+
+        if (this->mode_ == ParserMode::kStreaming)
+        {
+            this->Interpret(
+                [&]() { this->interpreter_.BeginStream(root_node, dest); });
 
-        this->ProcessTokens(root_node);
+            this->ProcessTokens(root_node);
 
-        this->interpreter_.ConvertNodeTree(root_node, dest);
+            if (this->interpreter_error_)
+                throw *this->interpreter_error_;
+
+            this->interpreter_.EndStream(dest);
+        }
+        else
+        {
+            this->ProcessTokens(root_node);
+
+            this->interpreter_.ConvertNodeTree(root_node, dest);
+        }
     }
     catch(const LexerException& e)
     {
-        return ParserResult(e.type, e.message, e.token.position);
+        result = ParserResult(e.type, e.message,
+                              this->lexer_.GetPosition(e.token.location));
     }
     catch (const ParserException& e)
     {
-        return ParserResult(e.type, e.message, e.token.position);
+        result = ParserResult(e.type, e.message,
+                              this->lexer_.GetPosition(e.token.location));
     }
     catch (const InterpreterException& e)
     {
-        return ParserResult(e.type, e.message, e.node.position);
+        result = ParserResult(e.type, e.message,
+                              this->lexer_.GetPosition(e.location));
+    }
+    catch (const AtomTableFull& e)
+    {
+        result = ParserResult(ParserResultType::kTooManyNames, e.what(),
+                              ParserPosition({ }, "", 0, 0, 0));
     }
 
-    return ParserResult(ParserResultType::kSuccess);
+    // The streaming mode has already created the objects in front of the
+    // error, the global object has to be empty like after the node tree mode
+    if (!result)
+        dest.Reset();
+
+    // The node tree is not needed anymore, free every node at once
+    this->node_arena_.Reset();
+
+    return result;
 }
 
 void Parser::Reset()
 {
     this->lexer_.Reset();
     this->interpreter_.Reset();
+    this->node_arena_.Reset();
+    this->interpreter_error_.reset();
+}
+
+void Parser::ReleaseMemory()
+{
+    this->Reset();
+    this->node_arena_.Release();
 }
 
-void Parser::ProcessTokens(std::shared_ptr<ParserNode> parent_node)
+template<typename Event>
+void Parser::Interpret(const Event& event)
 {
-    if (!parent_node)
+    if (this->interpreter_error_)
         return;
 
+    try
+    {
+        event();
+    }
+    catch (const InterpreterException& e)
+    {
+        this->interpreter_error_.emplace(e);
+    }
+}
+
+void Parser::ProcessTokens(ParserNode& parent_node)
+{
     LexerToken token;
     while (this->lexer_.GetNextToken(token))
     {
-        if (TokenIsBlockEnd(*parent_node))
+        if (TokenIsBlockEnd(parent_node))
             return;
 
         if (TokenIsObjectNode())
-            this->CreateObjectNode(*parent_node);
+            this->CreateObjectNode(parent_node);
         else if (TokenIsAttributeAssignNode())
-            this->CreateAttributeAssignNode(*parent_node);
+            this->CreateAttributeAssignNode(parent_node);
         else
             throw UndefinedTokenSequence(token);
     }
@@ -68,7 +159,7 @@ void Parser::ProcessTokens(std::shared_ptr<ParserNode> parent_node)
 
 bool Parser::TokenIsBlockEnd(const ParserNode& current_node)
 {
-    LexerToken token = this->lexer_.LookAhead(0);
+    const LexerToken& token = this->lexer_.LookAhead(0);
     if (token.type == LexerTokenType::kCBracketClose)
     {
         if (current_node.type == ParserNodeType::kRootNode)
@@ -83,8 +174,8 @@ bool Parser::TokenIsBlockEnd(const ParserNode& current_node)
 /* Object node */
 bool Parser::TokenIsObjectNode()
 {
-    const LexerToken current_token = this->lexer_.LookAhead(0);
-    const LexerToken next_token    = this->lexer_.LookAhead(1);
+    const LexerToken& current_token = this->lexer_.LookAhead(0);
+    const LexerToken& next_token    = this->lexer_.LookAhead(1);
 
     if (current_token.type != LexerTokenType::kData)
         return false;
@@ -101,12 +192,12 @@ bool Parser::TokenIsObjectNode()
 void Parser::CreateObjectNode(ParserNode& parent_node)
 {
     LexerToken token = this->lexer_.LookAhead(0);
-    ParserPosition object_position = token.position;
+    SourceLocation object_location = token.location;
 
-    const std::string type = token.data;
-    std::string id = "";
+    const Atom type = this->GetTokenAtom(token);
+    Atom id;
 
-    size_t end_position = this->lexer_.LookAhead(0).position.end;
+    SourceLocation end_location = token.location;
 
     if (!this->lexer_.GetNextToken(token))
         throw UnexpectedEndOfFile(this->lexer_.LookAhead(0));
@@ -120,10 +211,8 @@ void Parser::CreateObjectNode(ParserNode& parent_node)
         if (token.type != LexerTokenType::kData)
             throw ObjectIDWrongValueType(token);
 
-        id = token.data;
-        end_position = token.position.end;
-
-        end_position = this->lexer_.LookAhead(0).position.end;
+        id = this->GetTokenAtom(token);
+        end_location = token.location;
 
         // Move one token, where we expect the start of the object block
         if (!this->lexer_.GetNextToken(token))
@@ -133,24 +222,35 @@ void Parser::CreateObjectNode(ParserNode& parent_node)
     if (token.type != LexerTokenType::kCBracketOpen)
         throw ExpectedStartOfBlock(token);
 
-    object_position.end = end_position;
+    object_location = object_location.Extend(end_location);
 
-    std::shared_ptr<ParserNode> node =
-        std::make_shared<ParserObjectNode>(type, id, object_position);
+    if (this->mode_ == ParserMode::kStreaming)
+    {
+        // Only the nodes of the objects that are currently open exist
+        ParserObjectNode node(type, id, object_location);
+
+        this->Interpret([&]() { this->interpreter_.StreamObjectBegin(node); });
+        this->ProcessTokens(node);
+        this->Interpret([&]() { this->interpreter_.StreamObjectEnd(node); });
+
+        return;
+    }
 
-    if (!node)
-        throw UnableToCreateObjectNode(token);
+    ParserNode* node = this->node_arena_.Create<ParserObjectNode>(
+        type, id, object_location);
 
-    this->ProcessTokens(node);
+    // The node is added before its children are processed, so that it is
+    // owned by the tree even if an exception is thrown
+    parent_node.AddChild(node);
 
-    parent_node.child_nodes.push_back(node);
+    this->ProcessTokens(*node);
 }
 
 /* Attribute assign node */
 bool Parser::TokenIsAttributeAssignNode()
 {
-    const LexerToken current_token = this->lexer_.LookAhead(0);
-    const LexerToken next_token    = this->lexer_.LookAhead(1);
+    const LexerToken& current_token = this->lexer_.LookAhead(0);
+    const LexerToken& next_token    = this->lexer_.LookAhead(1);
 
     if (current_token.type == LexerTokenType::kData &&
         next_token.type    == LexerTokenType::kEqual)
@@ -163,9 +263,9 @@ bool Parser::TokenIsAttributeAssignNode()
 
 void Parser::CreateAttributeAssignNode(ParserNode& parent_node)
 {
-    const std::string name = this->lexer_.LookAhead(0).data;
+    const Atom name = this->GetTokenAtom(this->lexer_.LookAhead(0));
 
-    const size_t start_position = this->lexer_.LookAhead(0).position.start;
+    const SourceLocation start_location = this->lexer_.LookAhead(0).location;
 
     LexerToken token;
     if (!this->lexer_.GetNextToken(token))
@@ -178,7 +278,7 @@ void Parser::CreateAttributeAssignNode(ParserNode& parent_node)
     if (!this->lexer_.GetNextToken(token))
         throw UnexpectedEndOfFile(this->lexer_.LookAhead(0));
 
-    std::shared_ptr<ParserNode> value_node;
+    ParserNode* value_node;
 
     if (this->TokenIsStringNode())
         value_node = this->CreateStringNode();
@@ -195,16 +295,23 @@ void Parser::CreateAttributeAssignNode(ParserNode& parent_node)
     else
         throw ValueNodeWrongType(token);
 
-    ParserPosition position = value_node->position;
-    position.start = start_position;
+    const SourceLocation location =
+        start_location.Extend(value_node->location);
+
+    ParserNode* node = this->node_arena_.Create<ParserAttributeAssignNode>(
+        name, value_node, location);
 
-    std::shared_ptr<ParserNode> node =
-        std::make_shared<ParserAttributeAssignNode>(name, value_node, position);
+    if (this->mode_ == ParserMode::kStreaming)
+    {
+        this->Interpret(
+            [&]() { this->interpreter_.StreamAttributeAssign(*node); });
 
-    if (!node)
-        throw UnableToCreateAttributeAssignNode(token);
+        // The arena only contains the nodes of the current attribute
+        this->node_arena_.Reset();
+        return;
+    }
 
-    parent_node.child_nodes.push_back(node);
+    parent_node.AddChild(node);
 }
 
 /* String node */
@@ -214,19 +321,14 @@ bool Parser::TokenIsStringNode()
                 ? true : false;
 }
 
-std::shared_ptr<ParserStringNode> Parser::CreateStringNode()
+ParserStringNode* Parser::CreateStringNode()
 {
     const LexerToken token = this->lexer_.LookAhead(0);
     if (token.type != LexerTokenType::kString)
         throw ValueNodeWrongType(token);
 
-    std::shared_ptr<ParserStringNode> node =
-        std::make_shared<ParserStringNode>(token.data, token.position);
-
-    if (!node)
-        throw UnableToCreateStringNode(token);
-
-    return node;
+    return this->node_arena_.Create<ParserStringNode>(
+        this->lexer_.GetTokenString(token), token.location);
 }
 
 /* Number node */
@@ -236,19 +338,14 @@ bool Parser::TokenIsIntNode()
                 ? true : false;
 }
 
-std::shared_ptr<ParserIntNode> Parser::CreateIntNode()
+ParserIntNode* Parser::CreateIntNode()
 {
     const LexerToken token = this->lexer_.LookAhead(0);
     if (token.type != LexerTokenType::kInt)
         throw ValueNodeWrongType(token);
 
-    std::shared_ptr<ParserIntNode> node =
-        std::make_shared<ParserIntNode>(token.data, token.position);
-
-    if (!node)
-        throw UnableToCreateNumberNode(token);
-
-    return node;
+    return this->node_arena_.Create<ParserIntNode>(
+        token.int_value, token.location);
 }
 
 /* Float node */
@@ -258,19 +355,14 @@ bool Parser::TokenIsFloatNode()
                 ? true : false;
 }
 
-std::shared_ptr<ParserFloatNode> Parser::CreateFloatNode()
+ParserFloatNode* Parser::CreateFloatNode()
 {
     const LexerToken token = this->lexer_.LookAhead(0);
     if (token.type != LexerTokenType::kFloat)
         throw ValueNodeWrongType(token);
 
-    std::shared_ptr<ParserFloatNode> node =
-        std::make_shared<ParserFloatNode>(token.data, token.position);
-
-    if (!node)
-        throw UnableToCreateNumberNode(token);
-
-    return node;
+    return this->node_arena_.Create<ParserFloatNode>(
+        token.float_value, token.location);
 }
 
 /* Bool node */
@@ -280,19 +372,14 @@ bool Parser::TokenIsBoolNode()
                 ? true : false;
 }
 
-std::shared_ptr<ParserBoolNode> Parser::CreateBoolNode()
+ParserBoolNode* Parser::CreateBoolNode()
 {
     const LexerToken token = this->lexer_.LookAhead(0);
     if (token.type != LexerTokenType::kBool)
         throw ValueNodeWrongType(token);
 
-    std::shared_ptr<ParserBoolNode> node =
-        std::make_shared<ParserBoolNode>(token.data, token.position);
-
-    if (!node)
-        throw UnableToCreateBoolNode(token);
-
-    return node;
+    return this->node_arena_.Create<ParserBoolNode>(
+        this->lexer_.GetTokenString(token), token.location);
 }
 
 /* Vector node */
@@ -302,20 +389,17 @@ bool Parser::TokenIsVectorNode()
                 ? true : false;
 }
 
-std::shared_ptr<ParserVectorNode> Parser::CreateVectorNode()
+ParserVectorNode* Parser::CreateVectorNode()
 {
     LexerToken token = this->lexer_.LookAhead(0);
 
     if (token.type != LexerTokenType::kBracketOpen)
         throw ValueNodeWrongType(token);
 
-    const size_t start_position = token.position.start;
+    const SourceLocation start_location = token.location;
 
-    std::shared_ptr<ParserVectorNode> node =
-        std::make_shared<ParserVectorNode>(token.position);
-
-    if (!node)
-        throw UnableToCreateVectorNode(token);
+    ParserVectorNode* node =
+        this->node_arena_.Create<ParserVectorNode>(token.location);
 
     while (token.type != LexerTokenType::kBracketClose)
     {
@@ -333,7 +417,7 @@ std::shared_ptr<ParserVectorNode> Parser::CreateVectorNode()
         if (token.type == LexerTokenType::kBracketClose)
             break;
 
-        std::shared_ptr<ParserNode> value_node;
+        ParserNode* value_node;
 
         if (this->TokenIsStringNode())
             value_node = this->CreateStringNode();
@@ -346,12 +430,10 @@ std::shared_ptr<ParserVectorNode> Parser::CreateVectorNode()
         else
             throw ValueNodeWrongType(token);
 
-        node->child_nodes.push_back(value_node);
+        node->AddChild(value_node);
     }
 
-    ParserPosition position = token.position;
-    position.start = start_position;
-    node->position = position;
+    node->location = start_location.Extend(token.location);
 
     return node;
 }
@@ -359,7 +441,7 @@ std::shared_ptr<ParserVectorNode> Parser::CreateVectorNode()
 /* Attribute access node */
 bool Parser::TokenIsAttributeAccessNode()
 {
-    const LexerToken current_token = this->lexer_.LookAhead(0);
+    const LexerToken& current_token = this->lexer_.LookAhead(0);
 
     if (current_token.type == LexerTokenType::kData)
         return true;
@@ -367,19 +449,22 @@ bool Parser::TokenIsAttributeAccessNode()
     return false;
 }
 
-std::shared_ptr<ParserAttributeAccessNode> Parser::CreateAttributeAccessNode()
+ParserAttributeAccessNode* Parser::CreateAttributeAccessNode()
 {
     const LexerToken token = this->lexer_.LookAhead(0);
     if (token.type != LexerTokenType::kData)
         throw ValueNodeWrongType(token);
 
-    std::shared_ptr<ParserAttributeAccessNode> node =
-        std::make_shared<ParserAttributeAccessNode>(token.data, token.position);
+    return this->node_arena_.Create<ParserAttributeAccessNode>(
+        token.atom, this->lexer_.GetTokenData(token), token.location);
+}
 
-    if (!node)
-        throw UnableToCreateAttributeAccessNode(token);
+Atom Parser::GetTokenAtom(const LexerToken& token) const
+{
+    if (!token.atom.Empty())
+        return token.atom;
 
-    return node;
+    return Atom(this->lexer_.GetTokenData(token));
 }
 
 }  // namespace imgui_markup::internal::parser
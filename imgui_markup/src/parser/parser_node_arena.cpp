@@ -0,0 +1,94 @@
+#include "impch.h"
+#include "imgui_markup/parser/parser_node_arena.h"
+
+#include <cstdint>
+
+namespace imgui_markup::internal::parser
+{
+
+ParserNodeArena::~ParserNodeArena()
+{
+    this->Release();
+}
+
+void ParserNodeArena::Reset()
+{
+    for (auto it = this->destructors_.rbegin();
+         it != this->destructors_.rend(); it++)
+    {
+        it->destroy(it->object);
+    }
+
+    this->destructors_.clear();
+    this->large_blocks_.clear();
+
+    this->current_block_ = 0;
+
+    if (this->blocks_.empty())
+        return;
+
+    this->cursor_ = this->blocks_.front().get();
+    this->end_    = this->cursor_ + kBlockSize;
+}
+
+void ParserNodeArena::Release()
+{
+    this->Reset();
+
+    this->blocks_.clear();
+    this->blocks_.shrink_to_fit();
+    this->destructors_.shrink_to_fit();
+
+    this->cursor_ = nullptr;
+    this->end_    = nullptr;
+}
+
+void* ParserNodeArena::Allocate(size_t size, size_t alignment)
+{
+    const auto align = [alignment](char* pointer)
+    {
+        const uintptr_t address = reinterpret_cast<uintptr_t>(pointer);
+        return pointer + ((alignment - address % alignment) % alignment);
+    };
+
+    if (this->cursor_)
+    {
+        char* memory = align(this->cursor_);
+        if (memory + size <= this->end_)
+        {
+            this->cursor_ = memory + size;
+            return memory;
+        }
+    }
+
+    // Nodes are much smaller than a block, larger objects get their
+    // own block
+    if (size + alignment > kBlockSize)
+    {
+        this->large_blocks_.push_back(
+            AllocateBlock<char, MemorySubsystem::kParser>(size + alignment));
+        return align(this->large_blocks_.back().get());
+    }
+
+    // Blocks of the previous node trees are used before new blocks
+    // are allocated
+    if (this->cursor_ && this->current_block_ + 1 < this->blocks_.size())
+    {
+        this->current_block_++;
+    }
+    else
+    {
+        this->blocks_.push_back(
+            AllocateBlock<char, MemorySubsystem::kParser>(kBlockSize));
+        this->current_block_ = this->blocks_.size() - 1;
+    }
+
+    char* block   = this->blocks_[this->current_block_].get();
+    char* memory  = align(block);
+    this->cursor_ = memory + size;
+    this->end_    = block + kBlockSize;
+
+    return memory;
+}
+
+}  // namespace imgui_markup::internal::parser
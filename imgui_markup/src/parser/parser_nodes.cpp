@@ -4,64 +4,75 @@
 namespace imgui_markup::internal::parser
 {
 
-ParserNode::ParserNode(ParserNodeType type, ParserPosition position)
-    : type(type), position(position)
+ParserNode::ParserNode(ParserNodeType type, SourceLocation location)
+    : type(type), location(location)
 { }
 
+void ParserNode::AddChild(ParserNode* child)
+{
+    if (this->last_child)
+        this->last_child->next_sibling = child;
+    else
+        this->first_child = child;
+
+    this->last_child = child;
+}
+
 ParserObjectNode::ParserObjectNode(
-    std::string object_type,
-    std::string object_id,
-    ParserPosition position)
-    : ParserNode(ParserNodeType::kObjectNode, position),
+    Atom object_type,
+    Atom object_id,
+    SourceLocation location)
+    : ParserNode(ParserNodeType::kObjectNode, location),
       object_type(object_type), object_id(object_id)
 { }
 
 ParserStringNode::ParserStringNode(
     std::string value,
-    ParserPosition position)
-    : ParserNode(ParserNodeType::kStringNode, position),
+    SourceLocation location)
+    : ParserNode(ParserNodeType::kStringNode, location),
       value(value)
 { }
 
 ParserIntNode::ParserIntNode(
-    std::string value,
-    ParserPosition position)
-    : ParserNode(ParserNodeType::kIntNode, position),
+    int value,
+    SourceLocation location)
+    : ParserNode(ParserNodeType::kIntNode, location),
       value(value)
 { }
 
 ParserFloatNode::ParserFloatNode(
-    std::string value,
-    ParserPosition position)
-    : ParserNode(ParserNodeType::kFloatNode, position),
+    float value,
+    SourceLocation location)
+    : ParserNode(ParserNodeType::kFloatNode, location),
       value(value)
 { }
 
 ParserBoolNode::ParserBoolNode(
     std::string value,
-    ParserPosition position)
-    : ParserNode(ParserNodeType::kBoolNode, position),
+    SourceLocation location)
+    : ParserNode(ParserNodeType::kBoolNode, location),
       value(value)
 { }
 
 ParserVectorNode::ParserVectorNode(
-    ParserPosition position)
-    : ParserNode(ParserNodeType::kVectorNode, position)
+    SourceLocation location)
+    : ParserNode(ParserNodeType::kVectorNode, location)
 { }
 
 ParserAttributeAssignNode::ParserAttributeAssignNode(
-    std::string attribute_name,
-    std::shared_ptr<ParserNode> value_node,
-    ParserPosition position)
-    : ParserNode(ParserNodeType::kAttributeAssignNode, position),
+    Atom attribute_name,
+    ParserNode* value_node,
+    SourceLocation location)
+    : ParserNode(ParserNodeType::kAttributeAssignNode, location),
       attribute_name(attribute_name), value_node(value_node)
 { }
 
 ParserAttributeAccessNode::ParserAttributeAccessNode(
-    std::string attribute_name,
-    ParserPosition position)
-    : ParserNode(ParserNodeType::kAttributeAccessNode, position),
-      attribute_name(attribute_name)
+    Atom attribute_name,
+    std::string_view reference,
+    SourceLocation location)
+    : ParserNode(ParserNodeType::kAttributeAccessNode, location),
+      attribute_name(attribute_name), reference(reference)
 { }
 
 }  // namespace imgui_markup::internal::parser
@@ -0,0 +1,112 @@
+#include "impch.h"
+#include "imgui_markup/parser/parser_session.h"
+
+namespace imgui_markup
+{
+
+/* Parser session */
+ParserSession::ParserSession(ParserMode mode)
+    : parser_(mode)
+{ }
+
+ParserResult ParserSession::ParseFile(const char* path,
+                                      GlobalObject& global_object)
+{
+    return this->parser_.ParseFile(path, global_object);
+}
+
+ParserResult ParserSession::ParseData(std::string_view data,
+                                      GlobalObject& global_object)
+{
+    return this->parser_.ParseData(data, global_object);
+}
+
+ParserResult ParserSession::ParseBuffers(const char* path,
+                                         const VirtualFileSystem& files,
+                                         GlobalObject& global_object)
+{
+    return this->parser_.ParseBuffers(path, files, global_object);
+}
+
+void ParserSession::ReleaseMemory()
+{
+    this->parser_.ReleaseMemory();
+}
+
+/* Lease */
+ParserSessionPool::Lease::Lease(ParserSessionPool& pool,
+                                std::unique_ptr<ParserSession> session)
+    : pool_(&pool), session_(std::move(session))
+{ }
+
+ParserSessionPool::Lease::Lease(Lease&& other) noexcept
+    : pool_(other.pool_), session_(std::move(other.session_))
+{ }
+
+ParserSessionPool::Lease& ParserSessionPool::Lease::operator=(
+    Lease&& other) noexcept
+{
+    if (this == &other)
+        return *this;
+
+    if (this->session_)
+        this->pool_->Release(std::move(this->session_));
+
+    this->pool_    = other.pool_;
+    this->session_ = std::move(other.session_);
+
+    return *this;
+}
+
+ParserSessionPool::Lease::~Lease()
+{
+    if (this->session_)
+        this->pool_->Release(std::move(this->session_));
+}
+
+/* Parser session pool */
+ParserSessionPool::ParserSessionPool(ParserMode mode,
+                                     size_t max_idle_sessions)
+    : mode_(mode), max_idle_sessions_(max_idle_sessions)
+{ }
+
+ParserSessionPool::Lease ParserSessionPool::Acquire()
+{
+    {
+        std::lock_guard<std::mutex> lock(this->mutex_);
+
+        if (!this->idle_sessions_.empty())
+        {
+            std::unique_ptr<ParserSession> session =
+                std::move(this->idle_sessions_.back());
+            this->idle_sessions_.pop_back();
+
+            return Lease(*this, std::move(session));
+        }
+    }
+
+    return Lease(*this, std::make_unique<ParserSession>(this->mode_));
+}
+
+void ParserSessionPool::Clear()
+{
+    std::vector<std::unique_ptr<ParserSession>> sessions;
+
+    {
+        std::lock_guard<std::mutex> lock(this->mutex_);
+        sessions.swap(this->idle_sessions_);
+    }
+}
+
+void ParserSessionPool::Release(std::unique_ptr<ParserSession> session)
+{
+    std::lock_guard<std::mutex> lock(this->mutex_);
+
+    // The session is destroyed when the pool is full
+    if (this->idle_sessions_.size() >= this->max_idle_sessions_)
+        return;
+
+    this->idle_sessions_.push_back(std::move(session));
+}
+
+}  // namespace imgui_markup
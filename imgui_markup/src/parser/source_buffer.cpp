@@ -0,0 +1,207 @@
+#include "impch.h"
+#include "imgui_markup/parser/source_buffer.h"
+
+#if defined(_PLATFORM_LINUX)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#elif defined(_PLATFORM_WINDOWS)
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <windows.h>
+#endif  // _PLATFORM_LINUX
+
+namespace imgui_markup::internal::parser
+{
+
+namespace
+{
+
+// Used for empty files, so that an open buffer never points to nullptr
+const char kEmptyBuffer[1] = { 0 };
+
+}  // namespace
+
+bool GetFileIdentity(const std::string& path, FileIdentity& dest)
+{
+#if defined(_PLATFORM_LINUX)
+    struct stat info;
+    if (::stat(path.c_str(), &info) != 0 || !S_ISREG(info.st_mode))
+        return false;
+
+    dest.device = info.st_dev;
+    dest.inode  = info.st_ino;
+    dest.mtime  = static_cast<int64_t>(info.st_mtim.tv_sec) * 1000000000 +
+                  info.st_mtim.tv_nsec;
+    dest.size   = info.st_size;
+
+    return true;
+#elif defined(_PLATFORM_WINDOWS)
+    const HANDLE file = ::CreateFileA(
+        path.c_str(), 0, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+        nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+    BY_HANDLE_FILE_INFORMATION info;
+    const BOOL result = ::GetFileInformationByHandle(file, &info);
+    ::CloseHandle(file);
+
+    if (!result || (info.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY))
+        return false;
+
+    dest.device = info.dwVolumeSerialNumber;
+    dest.inode  = (static_cast<uint64_t>(info.nFileIndexHigh) << 32) |
+                  info.nFileIndexLow;
+    dest.mtime  = (static_cast<int64_t>(info.ftLastWriteTime.dwHighDateTime)
+                   << 32) | info.ftLastWriteTime.dwLowDateTime;
+    dest.size   = (static_cast<uint64_t>(info.nFileSizeHigh) << 32) |
+                  info.nFileSizeLow;
+
+    return true;
+#endif  // _PLATFORM_LINUX
+}
+
+SourceBuffer::~SourceBuffer()
+{
+    this->Close();
+}
+
+SourceBuffer::SourceBuffer(SourceBuffer&& other) noexcept
+    : data_(other.data_), size_(other.size_), mapped_(other.mapped_),
+      storage_(std::move(other.storage_))
+{
+    other.data_   = nullptr;
+    other.size_   = 0;
+    other.mapped_ = false;
+}
+
+SourceBuffer& SourceBuffer::operator=(SourceBuffer&& other) noexcept
+{
+    if (this == &other)
+        return *this;
+
+    this->Close();
+
+    this->data_    = other.data_;
+    this->size_    = other.size_;
+    this->mapped_  = other.mapped_;
+    this->storage_ = std::move(other.storage_);
+
+    other.data_   = nullptr;
+    other.size_   = 0;
+    other.mapped_ = false;
+
+    return *this;
+}
+
+bool SourceBuffer::Open(const std::string& path, bool map_file)
+{
+    this->Close();
+
+#if defined(_PLATFORM_LINUX)
+    if (map_file)
+        return this->Map(path);
+#endif  // _PLATFORM_LINUX
+
+    return this->Read(path);
+}
+
+void SourceBuffer::OpenView(std::string_view data)
+{
+    this->Close();
+
+    if (data.empty())
+    {
+        this->data_ = kEmptyBuffer;
+        return;
+    }
+
+    this->data_ = data.data();
+    this->size_ = data.size();
+}
+
+bool SourceBuffer::Read(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open())
+        return false;
+
+    const std::streamoff size = file.tellg();
+    if (size < 0)
+        return false;
+
+    if (size == 0)
+    {
+        this->data_ = kEmptyBuffer;
+        return true;
+    }
+
+    internal::MemoryBlock<char, MemorySubsystem::kLexer> storage =
+        internal::AllocateBlock<char, MemorySubsystem::kLexer>(size);
+
+    file.seekg(0);
+    if (!file.read(storage.get(), size))
+        return false;
+
+    this->storage_ = std::move(storage);
+    this->data_    = this->storage_.get();
+    this->size_    = size;
+
+    return true;
+}
+
+#if defined(_PLATFORM_LINUX)
+bool SourceBuffer::Map(const std::string& path)
+{
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat info;
+    if (::fstat(fd, &info) != 0 || !S_ISREG(info.st_mode))
+    {
+        ::close(fd);
+        return false;
+    }
+
+    if (info.st_size == 0)
+    {
+        ::close(fd);
+        this->data_ = kEmptyBuffer;
+        return true;
+    }
+
+    void* data = ::mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+
+    if (data == MAP_FAILED)
+        return false;
+
+    ::madvise(data, info.st_size, MADV_SEQUENTIAL);
+
+    this->data_   = static_cast<const char*>(data);
+    this->size_   = info.st_size;
+    this->mapped_ = true;
+
+    return true;
+}
+#endif  // _PLATFORM_LINUX
+
+void SourceBuffer::Close()
+{
+#if defined(_PLATFORM_LINUX)
+    if (this->mapped_)
+        ::munmap(const_cast<char*>(this->data_), this->size_);
+#endif  // _PLATFORM_LINUX
+
+    this->storage_.reset();
+
+    this->data_   = nullptr;
+    this->size_   = 0;
+    this->mapped_ = false;
+}
+
+}  // namespace imgui_markup::internal::parser
@@ -0,0 +1,224 @@
+#include "impch.h"
+#include "utility/thread_pool.h"
+
+namespace imgui_markup::internal::utils
+{
+
+namespace
+{
+
+// Pool and queue of the current worker thread
+thread_local const ThreadPool* current_pool = nullptr;
+thread_local size_t current_queue = 0;
+
+}  // namespace
+
+ThreadPool::ThreadPool(size_t thread_count)
+{
+    thread_count = std::max<size_t>(thread_count, 1);
+
+    for (size_t i = 0; i < thread_count; i++)
+        this->queues_.push_back(std::make_unique<Queue>());
+
+    for (size_t i = 0; i < thread_count; i++)
+        this->threads_.emplace_back(&ThreadPool::Run, this, i);
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(this->mutex_);
+        this->stop_ = true;
+    }
+
+    this->condition_.notify_all();
+
+    for (auto& thread : this->threads_)
+        thread.join();
+}
+
+ThreadPool& ThreadPool::Get()
+{
+    // Most tasks are blocked by file I/O, so more threads than hardware
+    // threads are used on small machines
+    static ThreadPool pool(
+        std::max<size_t>(std::thread::hardware_concurrency(), 4));
+    return pool;
+}
+
+void ThreadPool::Submit(std::function<void()> task, TaskType type)
+{
+    size_t index = this->GetCurrentQueue();
+    if (index == this->queues_.size())
+        index = this->next_queue_++ % this->queues_.size();
+
+    // The task is counted before it is added, so that the counter never
+    // drops below zero when the task is taken right away
+    {
+        std::lock_guard<std::mutex> lock(this->mutex_);
+        this->pending_tasks_++;
+    }
+
+    {
+        Queue& queue = *this->queues_[index];
+
+        std::lock_guard<std::mutex> lock(queue.mutex);
+
+        if (type == TaskType::kHelper)
+            queue.helper_tasks.push_back(std::move(task));
+        else
+            queue.tasks.push_back(std::move(task));
+    }
+
+    this->condition_.notify_one();
+
+    // Only after the task was added, so that a waiting thread can take it
+    this->NotifyProgress();
+}
+
+uint64_t ThreadPool::GetProgress()
+{
+    std::lock_guard<std::mutex> lock(this->mutex_);
+    return this->progress_;
+}
+
+void ThreadPool::WaitForProgress(uint64_t progress)
+{
+    std::unique_lock<std::mutex> lock(this->mutex_);
+    this->progress_condition_.wait(lock, [this, progress]()
+        { return this->progress_ != progress; });
+}
+
+bool ThreadPool::RunPendingTask()
+{
+    std::function<void()> task;
+    if (!this->TakeTask(this->GetCurrentQueue(), false, task))
+        return false;
+
+    this->RunTask(task);
+    return true;
+}
+
+bool ThreadPool::RunPendingHelperTask()
+{
+    std::function<void()> task;
+    if (!this->TakeTask(this->GetCurrentQueue(), true, task))
+        return false;
+
+    this->RunTask(task);
+    return true;
+}
+
+void ThreadPool::RunTask(std::function<void()>& task)
+{
+    task();
+
+    // The task is destroyed first, so that everything it captured is
+    // released when a waiting thread continues
+    task = nullptr;
+
+    this->NotifyProgress();
+}
+
+void ThreadPool::NotifyProgress()
+{
+    {
+        std::lock_guard<std::mutex> lock(this->mutex_);
+        this->progress_++;
+    }
+
+    this->progress_condition_.notify_all();
+}
+
+void ThreadPool::Run(size_t index)
+{
+    current_pool  = this;
+    current_queue = index;
+
+    while (true)
+    {
+        std::function<void()> task;
+        if (this->TakeTask(index, false, task))
+        {
+            this->RunTask(task);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(this->mutex_);
+        this->condition_.wait(lock, [this]()
+            { return this->stop_ || this->pending_tasks_ > 0; });
+
+        // The remaining tasks are processed before the thread stops, so
+        // that no task is dropped
+        if (this->stop_ && this->pending_tasks_ == 0)
+            return;
+    }
+}
+
+bool ThreadPool::TakeTask(size_t index, bool helpers_only,
+                          std::function<void()>& dest)
+{
+    const size_t count = this->queues_.size();
+
+    // Newest task of the own queue
+    if (index < count)
+    {
+        Queue& queue = *this->queues_[index];
+
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (this->TakeTask(queue, true, helpers_only, dest))
+            return true;
+    }
+
+    // Oldest task of any other queue
+    for (size_t i = 1; i <= count; i++)
+    {
+        const size_t victim = (index + i) % count;
+        if (victim == index)
+            continue;
+
+        Queue& queue = *this->queues_[victim];
+
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (this->TakeTask(queue, false, helpers_only, dest))
+            return true;
+    }
+
+    return false;
+}
+
+bool ThreadPool::TakeTask(Queue& queue, bool newest, bool helpers_only,
+                          std::function<void()>& dest)
+{
+    std::deque<std::function<void()>>* tasks = &queue.helper_tasks;
+    if (tasks->empty() && !helpers_only)
+        tasks = &queue.tasks;
+
+    if (tasks->empty())
+        return false;
+
+    if (newest)
+    {
+        dest = std::move(tasks->back());
+        tasks->pop_back();
+    }
+    else
+    {
+        dest = std::move(tasks->front());
+        tasks->pop_front();
+    }
+
+    // The queue mutex is always locked before the pool mutex, Submit
+    // never holds both at the same time
+    std::lock_guard<std::mutex> lock(this->mutex_);
+    this->pending_tasks_--;
+
+    return true;
+}
+
+size_t ThreadPool::GetCurrentQueue() const
+{
+    return current_pool == this ? current_queue : this->queues_.size();
+}
+
+}  // namespace imgui_markup::internal::utils
@@ -0,0 +1,214 @@
+#ifndef IMGUI_MARKUP_SRC_UTILITY_THREAD_POOL_H_
+#define IMGUI_MARKUP_SRC_UTILITY_THREAD_POOL_H_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace imgui_markup::internal::utils
+{
+
+/**
+ * Fixed number of worker threads with one task queue per thread.
+ * Tasks that are submitted by a worker thread are added to its own queue
+ * and processed in last in, first out order, which keeps the data of
+ * related tasks in the cache. Every other task is distributed over the
+ * queues. Threads without tasks steal the oldest task of another thread.
+ */
+class ThreadPool
+{
+public:
+    enum class TaskType
+    {
+        /**
+         * Task that can wait for other tasks, e.g. parsing a whole file.
+         */
+        kDefault,
+
+        /**
+         * Short task that never waits for other tasks, e.g. loading a
+         * single file. Only helper tasks are run by Wait, so a waiting
+         * task never starts another task that waits as well.
+         */
+        kHelper
+    };
+
+    /**
+     * @param thread_count - Number of worker threads, at least one thread
+     *                       is created.
+     */
+    explicit ThreadPool(size_t thread_count);
+
+    /**
+     * Processes the remaining tasks, including the tasks they submit, and
+     * stops the worker threads.
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * Process wide pool, using one thread per hardware thread and at
+     * least four threads. The pool is created on the first call.
+     */
+    static ThreadPool& Get();
+
+    /**
+     * Adds a task to a queue. Tasks should not throw exceptions.
+     * Tasks that wait for helper tasks have to use the Wait function.
+     */
+    void Submit(std::function<void()> task,
+                TaskType type = TaskType::kDefault);
+
+    /**
+     * Processes one pending task on the calling thread.
+     * Must not be called by a task, because it can start a task that
+     * waits as well, see Wait.
+     *
+     * @return false if there was no pending task.
+     */
+    bool RunPendingTask();
+
+    /**
+     * Waits until the future of a helper task is ready. Pending helper
+     * tasks are processed while waiting, so that the task the future
+     * depends on is never blocked by the waiting thread. Other tasks are
+     * not started, so the nesting depth of tasks on the stack of the
+     * waiting thread is at most one.
+     */
+    template<typename T>
+    T Wait(const std::shared_future<T>& future)
+    {
+        while (true)
+        {
+            // Read before the future is checked, so that a task that
+            // finishes in between is not missed
+            const uint64_t progress = this->GetProgress();
+
+            if (future.wait_for(std::chrono::seconds(0)) ==
+                std::future_status::ready)
+            {
+                break;
+            }
+
+            // The task is running on another thread, new tasks might
+            // be submitted in the meantime
+            if (!this->RunPendingHelperTask())
+                this->WaitForProgress(progress);
+        }
+
+        return future.get();
+    }
+
+    /**
+     * Gets a counter that changes every time a task is submitted or a
+     * task finished, see WaitForProgress.
+     */
+    uint64_t GetProgress();
+
+    /**
+     * Blocks until a task was submitted or a task finished, after the
+     * progress was read through GetProgress.
+     * Used to wait for a condition that is changed by a task, without
+     * polling it. The progress has to be read before the condition is
+     * checked.
+     */
+    void WaitForProgress(uint64_t progress);
+
+    inline size_t GetThreadCount() const { return this->threads_.size(); }
+
+private:
+    struct Queue
+    {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+        std::deque<std::function<void()>> helper_tasks;
+    };
+
+    std::vector<std::unique_ptr<Queue>> queues_;
+    std::vector<std::thread> threads_;
+
+    /**
+     * Used to put threads without tasks to sleep. The number of pending
+     * tasks is only changed while the mutex is locked, so that no wakeup
+     * is lost.
+     */
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    size_t pending_tasks_ = 0;
+    bool stop_ = false;
+
+    /**
+     * See GetProgress, changed while the mutex is locked.
+     */
+    std::condition_variable progress_condition_;
+    uint64_t progress_ = 0;
+
+    /**
+     * Queue used for tasks that are submitted from outside the pool.
+     */
+    std::atomic<size_t> next_queue_ = 0;
+
+    /**
+     * Main function of every worker thread.
+     */
+    void Run(size_t index);
+
+    /**
+     * Processes one pending helper task on the calling thread.
+     *
+     * @return false if there was no pending helper task.
+     */
+    bool RunPendingHelperTask();
+
+    /**
+     * Runs a task and wakes up the threads waiting for progress.
+     */
+    void RunTask(std::function<void()>& task);
+
+    /**
+     * Changes the progress and wakes up the threads waiting for it.
+     */
+    void NotifyProgress();
+
+    /**
+     * Takes the newest task of the own queue or steals the oldest task
+     * of another queue. Helper tasks are taken before other tasks.
+     *
+     * @param index        - Queue of the calling thread, or the number of
+     *                       queues if the thread is not a worker thread.
+     * @param helpers_only - Only takes helper tasks.
+     * @return false if every queue is empty.
+     */
+    bool TakeTask(size_t index, bool helpers_only,
+                  std::function<void()>& dest);
+
+    /**
+     * Takes a task out of a queue, whose mutex has to be locked.
+     *
+     * @param newest - Takes the newest task instead of the oldest task.
+     */
+    bool TakeTask(Queue& queue, bool newest, bool helpers_only,
+                  std::function<void()>& dest);
+
+    /**
+     * Gets the queue of the calling thread.
+     *
+     * @return The number of queues if the calling thread is not a worker
+     *         thread of this pool.
+     */
+    size_t GetCurrentQueue() const;
+};
+
+}  // namespace imgui_markup::internal::utils
+
+#endif  // IMGUI_MARKUP_SRC_UTILITY_THREAD_POOL_H_
@@ -1,49 +1,145 @@
 #include "impch.h"
 #include "utility/utility.h"
 
+#include <charconv>
+#include <cstring>
+#include <iterator>
+
 namespace imgui_markup::internal::utils
 {
 
-bool StringToInt(std::string str, int* dest)
+namespace
 {
-    try
-    {
-        *dest = std::stoi(str);
-        return true;
-    }
-    catch (std::invalid_argument const& e)
-    {
-        return false;
-    }
-    catch (std::out_of_range const& e)
-    {
-        return false;
-    }
-    catch (std::exception const& e)
-    {
-        return false;
-    }
+
+/**
+ * Skips the leading whitespaces and the plus sign of a number,
+ * which are not accepted by std::from_chars.
+ */
+const char* SkipNumberPrefix(const char* c, const char* end)
+{
+    while (c < end && (*c == ' ' || (*c >= '\t' && *c <= '\r')))
+        c++;
+
+    if (c + 1 < end && c[0] == '+' && c[1] != '-')
+        c++;
+
+    return c;
 }
 
-bool StringToFloat(std::string str, float* dest)
+/**
+ * Fast path for decimal numbers with a small mantissa and without an
+ * exponent, e.g. "-12.5". If the mantissa and the power of ten are exactly
+ * representable as a float, a single division or multiplication is
+ * correctly rounded.
+ *
+ * @return nullptr if the number is not supported by the fast path,
+ *         otherwise the end of the number.
+ */
+const char* ParseFloatFast(const char* c, const char* end, float& dest)
 {
-    try
+    static constexpr float kPowersOfTen[] = {
+        1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+    static constexpr uint64_t kMaxMantissa = uint64_t(1) << 24;
+    static constexpr size_t kMaxDigits = 19;
+
+    const bool negative = c < end && *c == '-';
+    if (negative)
+        c++;
+
+    uint64_t mantissa = 0;
+    size_t digits = 0;
+    size_t fraction_digits = 0;
+
+    for (; c < end && *c >= '0' && *c <= '9'; c++, digits++)
+        mantissa = mantissa * 10 + (*c - '0');
+
+    if (c < end && *c == '.')
     {
-        *dest = std::stof(str);
-        return true;
+        for (c++; c < end && *c >= '0' && *c <= '9'; c++, fraction_digits++)
+            mantissa = mantissa * 10 + (*c - '0');
     }
-    catch (std::invalid_argument const& e)
+
+    digits += fraction_digits;
+
+    if (digits == 0 || digits > kMaxDigits || mantissa > kMaxMantissa ||
+        fraction_digits >= std::size(kPowersOfTen) ||
+        (c < end && (*c == 'e' || *c == 'E')))
     {
-        return false;
+        return nullptr;
     }
-    catch (std::out_of_range const& e)
-    {
+
+    const float value =
+        static_cast<float>(mantissa) / kPowersOfTen[fraction_digits];
+
+    dest = negative ? -value : value;
+    return c;
+}
+
+/**
+ * Slow path for every number that is not supported by the fast path.
+ *
+ * @return nullptr if the string could not be converted,
+ *         otherwise the end of the number.
+ */
+const char* ParseFloatSlow(const char* c, const char* end, float& dest)
+{
+#if defined(__cpp_lib_to_chars)
+    const std::from_chars_result result = std::from_chars(c, end, dest);
+    if (result.ec != std::errc())
+        return nullptr;
+
+    return result.ptr;
+#else
+    // Floating point std::from_chars is not supported by every
+    // standard library
+    std::istringstream stream(std::string(c, end));
+    stream.imbue(std::locale::classic());
+
+    float value;
+    if (!(stream >> value))
+        return nullptr;
+
+    dest = value;
+
+    return stream.eof() ? end : c + static_cast<size_t>(stream.tellg());
+#endif  // __cpp_lib_to_chars
+}
+
+}  // namespace
+
+bool StringToInt(std::string_view str, int* dest, size_t* length)
+{
+    const char* begin = str.data();
+    const char* end   = str.data() + str.size();
+    const char* c     = SkipNumberPrefix(begin, end);
+
+    const std::from_chars_result result = std::from_chars(c, end, *dest);
+    if (result.ec != std::errc())
         return false;
-    }
-    catch (std::exception const& e)
-    {
+
+    if (length)
+        *length = result.ptr - begin;
+
+    return true;
+}
+
+bool StringToFloat(std::string_view str, float* dest, size_t* length)
+{
+    const char* begin = str.data();
+    const char* end   = str.data() + str.size();
+    const char* c     = SkipNumberPrefix(begin, end);
+
+    const char* number_end = ParseFloatFast(c, end, *dest);
+    if (!number_end)
+        number_end = ParseFloatSlow(c, end, *dest);
+
+    if (!number_end)
         return false;
-    }
+
+    if (length)
+        *length = number_end - begin;
+
+    return true;
 }
 
 bool StringToBool(std::string str, bool* dest)
@@ -76,6 +172,37 @@ std::vector<std::string> SplitString(std::string str, const char c)
     return segments;
 }
 
+uint64_t HashData(std::string_view data, uint64_t seed)
+{
+    constexpr uint64_t kMultiplier = 0x9E3779B97F4A7C15ull;
+
+    const auto mix = [](uint64_t hash, uint64_t value)
+    {
+        hash ^= value;
+        hash *= kMultiplier;
+        return hash ^ (hash >> 29);
+    };
+
+    uint64_t hash = mix(seed, data.size());
+
+    const char* c   = data.data();
+    const char* end = c + data.size();
+
+    for (; end - c >= 8; c += 8)
+    {
+        uint64_t block;
+        std::memcpy(&block, c, sizeof(block));
+
+        hash = mix(hash, block);
+    }
+
+    uint64_t tail = 0;
+    if (c != end)
+        std::memcpy(&tail, c, end - c);
+
+    return mix(hash, tail);
+}
+
 bool PathExists(const std::string path)
 {
     try
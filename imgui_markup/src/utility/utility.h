@@ -1,7 +1,9 @@
 #ifndef IMGUI_MARKUP_SRC_UTILITY_UTILITY_H_
 #define IMGUI_MARKUP_SRC_UTILITY_UTILITY_H_
 
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <iostream>
 
@@ -9,28 +11,38 @@ namespace imgui_markup::internal::utils
 {
 
 /**
- * Convert a string to an interger.
+ * Convert the beginning of a string to an interger.
+ * Leading whitespaces are skipped and the conversion stops at the first
+ * character that is not part of the number, like std::stoi.
+ * The conversion does not allocate, throw or depend on the locale.
  *
- * @param[in] str   - The string that will be converted.
- * @param[out] dest - A pointer to an integer that will recive the converted
- *                    string.
+ * @param[in] str     - The string that will be converted.
+ * @param[out] dest   - A pointer to an integer that will recive the converted
+ *                      string.
+ * @param[out] length - Optional, receives the number of characters that
+ *                      were converted, including the skipped whitespaces.
  *
  * @return true if there was no error, false if the string could not be
  *         converted to an interger.
 */
-bool StringToInt(std::string str, int* dest);
+bool StringToInt(std::string_view str, int* dest, size_t* length = nullptr);
 
 /**
- * Convert a string to a float.
+ * Convert the beginning of a string to a float.
+ * Leading whitespaces are skipped and the conversion stops at the first
+ * character that is not part of the number, like std::stof.
+ * The conversion does not allocate, throw or depend on the locale.
  *
- * @param[in] str   - The string that will be converted.
- * @param[out] dest - A pointer to a float that will recive the converted
- *                    string.
+ * @param[in] str     - The string that will be converted.
+ * @param[out] dest   - A pointer to a float that will recive the converted
+ *                      string.
+ * @param[out] length - Optional, receives the number of characters that
+ *                      were converted, including the skipped whitespaces.
  *
  * @return true if there was no error, false if the string could not be
  *         converted to a float.
 */
-bool StringToFloat(std::string str, float* dest);
+bool StringToFloat(std::string_view str, float* dest, size_t* length = nullptr);
 
 /**
  * Convert a string to a bool. The possible string values are:
@@ -65,6 +77,18 @@ std::string BoolToString(const bool b);
 */
 std::vector<std::string> SplitString(std::string str, const char c);
 
+/**
+ * Calculates a 64 bit hash of the data, e.g. to detect changes of a file.
+ * The data is processed in blocks of 8 bytes, so that large files can be
+ * hashed quickly. The hash is not suitable for cryptographic purposes.
+ *
+ * @param[in] data - The data that will be hashed.
+ * @param[in] seed - Initial value, used to combine multiple hashes.
+ *
+ * @return The hash of the data.
+ */
+uint64_t HashData(std::string_view data, uint64_t seed = 0);
+
 /**
  * std::filesystem::exists wrapper to handle exceptions.
  */
@@ -25,4 +25,6 @@ group ""
 
 include "imgui_markup"
 include "sandbox"
+include "compiler"
+include "benchmark"
 
@@ -35,30 +35,45 @@ void MainState::Init()
        this->ignore_control_window_ = true;
     }
 
+    this->reload_button_ = this->control_window_.GetObjectHandle("btn_reload");
+
+    std::vector<std::string> paths;
     for (auto const& entry : fs::directory_iterator(
        this->test_folder_))
     {
        if (entry.path().extension() != ".ill")
            continue;
 
-       this->tests_.emplace_back(gui::GlobalObject());
-       result = gui::ParseFile(entry.path().string().c_str(), this->tests_.back());
+       paths.push_back(entry.path().string());
+    }
 
-       if (result.type_ != gui::ParserResultType::kSuccess)
-       {
-            std::cerr << "Unable to load test " << entry.path() << ":\n" <<
-                result.ToString() << std::endl;
+    std::vector<const char*> path_list;
+    for (const auto& path : paths)
+        path_list.push_back(path.c_str());
 
-            this->tests_.pop_back();
+    // Every test is independent, so they are parsed at once. The global
+    // objects are constructed in place, because they can not be moved.
+    this->tests_ = std::vector<gui::GlobalObject>(paths.size());
 
-           continue;
-       }
+    const std::vector<gui::ParserResult> results = gui::ParseFiles(
+        path_list.data(), this->tests_.data(), this->tests_.size());
+
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        if (results[i].type_ != gui::ParserResultType::kSuccess)
+        {
+            std::cerr << "Unable to load test " << paths[i] << ":\n" <<
+                results[i].ToString() << std::endl;
+
+            // The test stays empty, so that it is not drawn
+            this->tests_[i].Reset();
+        }
     }
 }
 
 void MainState::UpdateControlWindow()
 {
-    if (this->control_window_.IsPressed("btn_reload"))
+    if (this->control_window_.IsPressed(this->reload_button_))
         this->Init();
 
     this->control_window_.Update();
@@ -20,6 +20,7 @@ private:
     const std::string test_folder_ = "tests";
 
     gui::GlobalObject control_window_;
+    gui::ObjectHandle reload_button_;
     bool ignore_control_window_ = false;
 
     std::vector<gui::GlobalObject> tests_;